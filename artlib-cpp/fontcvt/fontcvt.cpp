@@ -5,12 +5,19 @@
  * https://opensource.org/licenses/MIT
  */
 
+#include "algorithm"
 #include "artlib.hpp"
+#include "cctype"
+#include "cstdint"
+#include "cstring"
+#include "filesystem"
 #include "fstream"
 #include "iostream"
 #include "json.hpp"
+#include "limits"
 #include "map"
 #include "memory"
+#include "sstream"
 #include "string"
 #include "type_traits"
 #include "vector"
@@ -46,6 +53,7 @@ namespace srilakshmikanthanp
                                                    int64_t, uint64_t, double, alloc_type>;
             using istream_type  =   std::basic_istream<CharT, Traits>;
             using ostream_type  =   std::basic_ostream<CharT, Traits>;
+            using sstream_type  =   std::basic_istringstream<CharT, Traits, Alloc<CharT>>;
             // clang-format on
 
             /**
@@ -60,6 +68,7 @@ namespace srilakshmikanthanp
                 char_type                                     HardBlank { 0 };
                 size_type                                     Height { 0 };
                 size_type                                     Shrink { 0 };
+                long                                          Layout { -1 };
 
                public:
                 figlettoanixt()                        = default;
@@ -97,6 +106,7 @@ namespace srilakshmikanthanp
                     this->json_font[cvt( "anixt_config" )][cvt( "Height" )]    = this->Height;
                     this->json_font[cvt( "anixt_config" )][cvt( "HardBlank" )] = this->HardBlank;
                     this->json_font[cvt( "anixt_config" )][cvt( "Shrink" )]    = this->Shrink;
+                    this->json_font[cvt( "anixt_config" )][cvt( "Layout" )]    = this->Layout;
 
                     for ( char_type ch = ' '; ch <= '~'; ch++ )
                     {
@@ -111,6 +121,15 @@ namespace srilakshmikanthanp
                     return *this;
                 }
 
+                /**
+                 * @brief  returns json_font, call update before this
+                 * @return anixt json font
+                 **/
+                const json_type &get_json_font() const
+                {
+                    return this->json_font;
+                }
+
                 /**
                  * @brief operator<< outputs to stream
                  * @param stream stream
@@ -125,14 +144,18 @@ namespace srilakshmikanthanp
 
                private:
                 /**
-                 * @brief read config and skip comments in stream
+                 * @brief read config and skip comments in stream, Shrink
+                 *        and Layout are taken from old and full layout
                  * @param stream stream
                  **/
                 void readconfigandskipcomment( istream_type &stream )
                 {
-                    string_type str {};
-                    size_type   dummy { 0 };
-                    size_type   cmnt { 0 };
+                    string_type                    str {};
+                    size_type                      dummy { 0 };
+                    size_type                      cmnt { 0 };
+                    long                           direction { 0 };
+                    anixt_flf_scanner::header_type head { 0, 0, 0, -1 };
+                    sstream_type                   rest {};
 
                     stream >> str;
 
@@ -151,12 +174,22 @@ namespace srilakshmikanthanp
 
                     stream >> dummy;
 
-                    stream >> dummy;
+                    stream >> head.old_layout; // old layout
 
                     stream >> cmnt; // comment line
 
                     std::getline( stream, str );
 
+                    rest.str( str );
+
+                    if ( rest >> direction )
+                    {
+                        rest >> head.full_layout; // full layout
+                    }
+
+                    this->Layout = anixt_flf_scanner::full_layout( head );
+                    this->Shrink = anixt_flf_scanner::shrink_level( head );
+
                     for ( size_type i = 0; i < cmnt; i++ )
                     {
                         std::getline( stream, str );
@@ -219,52 +252,387 @@ namespace srilakshmikanthanp
                     }
                 }
             };
-        };
 
-    } // namespace art
+            /**
+             * @class anixttobinary
+             * @brief converts anixt json font to anixt binary font
+             **/
+            class anixttobinary
+            {
+               private:
+                map_type<std::uint32_t, vector_type<string_type>> letters {};
+                size_type                                         HardBlank { 0 };
+                size_type                                         Height { 0 };
+                size_type                                         Shrink { 0 };
+                long                                              Layout { -1 };
 
-} // namespace srilakshmikanthanp
+               public:
+                anixttobinary()                        = default;
+                anixttobinary( const anixttobinary & ) = default;
+                anixttobinary( anixttobinary && )      = default;
+                ~anixttobinary()                       = default;
 
-using namespace srilakshmikanthanp::art;
+                anixttobinary &operator=( const anixttobinary & ) = default;
+                anixttobinary &operator=( anixttobinary && ) = default;
 
-int main()
-{
-    anixt<anixt_untouched_style> myanixt;
-    std::ifstream                flf_font;
-    fontcvt<char>::figlettoanixt cvt;
-    std::ofstream                json_font;
-    std::string                  path;
+                /**
+                 * @brief  operator>> inputs anixt json font from stream
+                 * @param  stream stream
+                 * @param  obj object
+                 * @return reference to stream
+                 **/
+                friend istream_type &operator>>( istream_type &stream, anixttobinary &obj )
+                {
+                    json_type json_font {};
+                    stream >> json_font;
+                    obj.update( json_font );
+                    return stream;
+                }
 
-    std::cout << "Copyright (c) 2020 Sri Lakshmi Kanthan P\n"
-              << "This software is released under the MIT License.\n"
-              << "https://opensource.org/licenses/MIT\n";
+                /**
+                 * @brief  reads letters and config from anixt json font
+                 *         and validates them, so binary font written
+                 *         from it is not validated again at load
+                 * @param  json_font anixt json font
+                 * @return returns reference to *obj
+                 **/
+                anixttobinary &update( const json_type &json_font )
+                {
+                    using config_type  = anixt_config<char_type, size_type, traits_type, Alloc>;
+                    const auto &config = json_font.at( cvt( "anixt_config" ) );
+                    config_type checked {};
 
-    do
-    {
-        flf_font.clear();
-        std::cout << "\nEnter FIGLET Font File Path : ";
-        std::cin >> path;
-        flf_font.open( path );
-    } while ( !flf_font.is_open() );
+                    this->HardBlank = config.at( cvt( "HardBlank" ) ).template get<size_type>();
+                    this->Height    = config.at( cvt( "Height" ) ).template get<size_type>();
+                    this->Shrink    = config.at( cvt( "Shrink" ) ).template get<size_type>();
+                    this->Layout    = config.contains( cvt( "Layout" ) ) ? config.at( cvt( "Layout" ) ).template get<long>() : -1;
+                    this->letters.clear();
 
-    do
-    {
-        json_font.clear();
-        std::cout << "\nEnter anixt Font File path  : ";
-        std::cin >> path;
-        json_font.open( path );
+                    checked.HardBlank = static_cast<char_type>( this->HardBlank );
+                    checked.Height    = this->Height;
+                    checked.Shrink    = static_cast<typename config_type::shrink>( this->Shrink );
+
+                    artlib_validate_config( checked, config_type::shrink::level_2 );
+                    artlib_validate_layout( this->Layout );
+
+                    const auto &letter = json_font.at( cvt( "anixt_letter" ) );
+
+                    for ( auto it = letter.begin(); it != letter.end(); ++it )
+                    {
+                        // keys are one codepoint
+                        const char_type *key = it.key().data();
+                        const char_type *end = key + it.key().size();
+                        char32_t         code = key != end ? artlib_decode( key, end ) : 0;
+
+                        if ( key != end || it.key().empty() )
+                        {
+                            continue;
+                        }
+
+                        auto rows = it.value().template get<vector_type<string_type>>();
+
+                        if ( rows.size() != this->Height )
+                        {
+                            throw std::runtime_error( "Height is not equal" );
+                        }
+
+                        justify( rows );
+
+                        string_type packed = pack( rows );
+                        size_type   width  = rows.empty() ? 0 : rows[0].size();
+
+                        artlib_validate_rows( packed.data(), packed.size(), size_type( 0 ), width, rows.size() );
+
+                        this->letters[code] = rows;
+                    }
+
+                    return *this;
+                }
+
+                /**
+                 * @brief  writes anixt binary font to stream, stream
+                 *         should be opened in binary mode. edges of
+                 *         letters are written so load only maps them
+                 * @param  stream stream
+                 * @return reference to stream
+                 **/
+                std::ostream &write( std::ostream &stream ) const
+                {
+                    anixt_binary_header    header {};
+                    std::uint64_t          offset { 0 };
+                    vector_type<size_type> left, right;
+
+                    for ( const auto &letter : this->letters )
+                    {
+                        const auto &rows = letter.second;
+                        artlib_edges( pack( rows ).data(), rows.empty() ? 0 : rows[0].size(), rows.size(), left, right );
+                    }
 
-    } while ( !json_font.is_open() );
+                    std::memcpy( header.magic, anixt_binary_header::magic_value, sizeof( header.magic ) );
+                    header.version      = anixt_binary_header::version_value;
+                    header.char_size    = sizeof( char_type );
+                    header.height       = static_cast<std::uint32_t>( this->Height );
+                    header.hardblank    = static_cast<std::uint32_t>( this->HardBlank );
+                    header.shrink       = static_cast<std::uint32_t>( this->Shrink );
+                    header.count        = static_cast<std::uint32_t>( this->letters.size() );
+                    header.index_offset = sizeof( header );
+                    header.edges_offset = header.index_offset + header.count * sizeof( anixt_binary_entry );
+                    header.edge_size    = sizeof( size_type );
+                    header.rows_offset  = header.edges_offset + ( left.size() + right.size() ) * sizeof( size_type );
+                    header.layout       = this->Layout;
+
+                    stream.write( reinterpret_cast<const char *>( &header ), sizeof( header ) );
+
+                    for ( const auto &[code, rows] : this->letters )
+                    {
+                        anixt_binary_entry entry {};
+                        entry.code   = code;
+                        entry.width  = static_cast<std::uint32_t>( rows.empty() ? 0 : rows[0].size() );
+                        entry.offset = offset;
+                        offset += std::uint64_t( entry.width ) * rows.size();
+                        stream.write( reinterpret_cast<const char *>( &entry ), sizeof( entry ) );
+                    }
 
-    flf_font >> cvt;
-    cvt.update();
-    json_font << cvt;
+                    stream.write( reinterpret_cast<const char *>( left.data() ), left.size() * sizeof( size_type ) );
+                    stream.write( reinterpret_cast<const char *>( right.data() ), right.size() * sizeof( size_type ) );
 
-    flf_font.close();
-    json_font.close();
+                    for ( const auto &letter : this->letters )
+                    {
+                        for ( const auto &row : letter.second )
+                        {
+                            stream.write( reinterpret_cast<const char *>( row.data() ),
+                                          row.size() * sizeof( char_type ) );
+                        }
+                    }
+
+                    return stream;
+                }
+
+                /**
+                 * @brief  writes font as c++ header of constexpr tables
+                 *         for anixt_static_font, font data is named
+                 *         name_data and font type is name. static font
+                 *         is indexed by code unit so letters beyond
+                 *         code unit are left out
+                 * @param  stream stream
+                 * @param  name identifier of font
+                 * @return reference to stream
+                 **/
+                std::ostream &write_header( std::ostream &stream, const std::string &name ) const
+                {
+                    std::string   guard  = "ANIXT_STATIC_FONT_" + name;
+                    std::uint64_t max    = this->letters.empty() ? 0 : this->letters.rbegin()->first + std::uint64_t( 1 );
+                    size_type     offset = 0;
+                    size_type     edge   = 0;
+
+                    max = std::min<std::uint64_t>( max, std::uint64_t( std::numeric_limits<std::make_unsigned_t<char_type>>::max() ) + 1 );
+
+                    for ( auto &c : guard )
+                    {
+                        c = static_cast<char>( std::toupper( static_cast<unsigned char>( c ) ) );
+                    }
+
+                    stream << "// generated by fontcvt, do not edit\n\n"
+                           << "#ifndef " << guard << "\n"
+                           << "#define " << guard << "\n\n"
+                           << "#include \"artlib.hpp\"\n\n"
+                           << "struct " << name << "_data\n{\n"
+                           << "    static constexpr char        hardblank = " << this->HardBlank << ";\n"
+                           << "    static constexpr std::size_t height    = " << this->Height << ";\n"
+                           << "    static constexpr std::size_t shrink    = " << this->Shrink << ";\n"
+                           << "    static constexpr long        layout    = " << this->Layout << ";\n\n"
+                           << "    static constexpr char rows[] =\n";
+
+                    for ( const auto &[code, rows] : this->letters )
+                    {
+                        if ( code >= max )
+                        {
+                            break;
+                        }
+
+                        stream << "        \"";
+
+                        for ( const auto &row : rows )
+                        {
+                            write_literal( stream, row );
+                        }
+
+                        stream << "\" // " << code << "\n";
+                    }
+
+                    stream << "        \"\";\n\n";
+
+                    write_edges( stream, "left", true, max );
+                    write_edges( stream, "right", false, max );
+
+                    stream << "    static constexpr srilakshmikanthanp::art::anixt_static_entry letters[] = {\n";
+
+                    if ( max == 0 )
+                    {
+                        stream << "        { 0, 0, 0, false },\n";
+                    }
+
+                    for ( std::uint32_t code = 0; code < max; code++ )
+                    {
+                        auto it = this->letters.find( code );
+
+                        if ( it == this->letters.end() )
+                        {
+                            stream << "        { 0, 0, 0, false },\n";
+                            continue;
+                        }
+
+                        size_type width = it->second.empty() ? 0 : it->second[0].size();
+
+                        stream << "        { " << offset << ", " << width << ", " << edge << ", true }, // " << code << "\n";
+                        offset += width * it->second.size();
+                        edge += it->second.size();
+                    }
+
+                    stream << "    };\n};\n\n"
+                           << "using " << name << " = srilakshmikanthanp::art::anixt_static_font<" << name << "_data>;\n\n"
+                           << "#endif\n";
+
+                    return stream;
+                }
+
+               private:
+                string_type cvt( const std::string &str )
+                {
+                    return string_type { str.begin(), str.end() };
+                }
+
+                /**
+                 * @brief  packs rows of letter in to one string
+                 * @param  rows rows of letter
+                 * @return rows one after other
+                 **/
+                static string_type pack( const vector_type<string_type> &rows )
+                {
+                    string_type packed;
+
+                    for ( const auto &row : rows )
+                    {
+                        packed += row;
+                    }
+
+                    return packed;
+                }
+
+                /**
+                 * @brief writes left or right edges of rows of all
+                 *        letters as constexpr array
+                 * @param stream stream
+                 * @param name name of array
+                 * @param is_left true for left edges
+                 * @param max letters of code below max are written
+                 **/
+                void write_edges( std::ostream &stream, const char *name, bool is_left, std::uint64_t max ) const
+                {
+                    stream << "    static constexpr std::size_t " << name << "[] = {\n";
+
+                    if ( this->letters.empty() || this->letters.begin()->first >= max )
+                    {
+                        stream << "        0,\n";
+                    }
+
+                    for ( const auto &[code, rows] : this->letters )
+                    {
+                        if ( code >= max )
+                        {
+                            break;
+                        }
+
+                        vector_type<size_type> left, right;
+                        size_type              width = rows.empty() ? 0 : rows[0].size();
+
+                        artlib_edges( pack( rows ).data(), width, rows.size(), left, right );
+
+                        stream << "       ";
+
+                        for ( auto e : is_left ? left : right )
+                        {
+                            stream << " " << e << ",";
+                        }
+
+                        stream << " // " << code << "\n";
+                    }
+
+                    stream << "    };\n\n";
+                }
+
+                /**
+                 * @brief writes row in to c++ string literal, other
+                 *        than printable ascii is written in octal
+                 * @param stream stream
+                 * @param row row of letter
+                 **/
+                static void write_literal( std::ostream &stream, const string_type &row )
+                {
+                    for ( auto ch : row )
+                    {
+                        auto code = static_cast<std::make_unsigned_t<char_type>>( ch );
+
+                        if ( code == '"' || code == '\\' || code == '?' )
+                        {
+                            stream << '\\' << static_cast<char>( code );
+                        }
+                        else if ( code >= 32 && code < 127 )
+                        {
+                            stream << static_cast<char>( code );
+                        }
+                        else
+                        {
+                            const char oct[] = { '\\',
+                                                 static_cast<char>( '0' + ( ( code >> 6 ) & 7 ) ),
+                                                 static_cast<char>( '0' + ( ( code >> 3 ) & 7 ) ),
+                                                 static_cast<char>( '0' + ( code & 7 ) ) };
+                            stream.write( oct, sizeof( oct ) );
+                        }
+                    }
+                }
+
+                void justify( vector_type<string_type> &svec )
+                {
+                    size_type max { 0 };
+
+                    for ( const auto &i : svec )
+                    {
+                        if ( max < i.size() )
+                        {
+                            max = i.size();
+                        }
+                    }
+
+                    for ( auto &i : svec )
+                    {
+                        if ( i.size() < max )
+                        {
+                            size_type difference = max - i.size();
+                            i += string_type( difference, ' ' );
+                        }
+                    }
+                }
+            };
+        };
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+using namespace srilakshmikanthanp::art;
+
+/**
+ * @brief prints few lines with created font
+ * @param path path to font
+ **/
+template <typename FontT>
+void preview( const std::string &path )
+{
+    anixt<anixt_untouched_style, FontT> myanixt;
 
     myanixt.set_font( path );
-    
+
     myanixt( "Font Created" );
 
     std::cout << myanixt.get_anixt_string();
@@ -284,6 +652,114 @@ int main()
     myanixt( "Enjoy" );
 
     std::cout << myanixt.get_anixt_string();
+}
+
+/**
+ * @brief  makes c++ identifier from file name
+ * @param  name file name
+ * @return identifier
+ **/
+std::string identifier( std::string name )
+{
+    for ( auto &c : name )
+    {
+        if ( !std::isalnum( static_cast<unsigned char>( c ) ) )
+        {
+            c = '_';
+        }
+    }
+
+    if ( name.empty() || std::isdigit( static_cast<unsigned char>( name[0] ) ) )
+    {
+        name.insert( 0, "font_" );
+    }
+
+    return name;
+}
+
+int main()
+{
+    std::ifstream                in_font;
+    std::ofstream                out_font;
+    fontcvt<char>::figlettoanixt flf;
+    fontcvt<char>::anixttobinary abf;
+    std::filesystem::path        in_path;
+    std::filesystem::path        out_path;
+    std::string                  path;
+
+    std::cout << "Copyright (c) 2020 Sri Lakshmi Kanthan P\n"
+              << "This software is released under the MIT License.\n"
+              << "https://opensource.org/licenses/MIT\n"
+              << "\nFIGLET(.flf) Font converts to anixt(.json), binary(.abf) or header(.hpp) Font"
+              << "\nanixt(.json) Font converts to binary(.abf) or header(.hpp) Font\n";
+
+    do
+    {
+        in_font.clear();
+        std::cout << "\nEnter FIGLET or anixt Font File Path : ";
+        std::cin >> path;
+        in_path = path;
+        in_font.open( path );
+    } while ( !in_font.is_open() );
+
+    do
+    {
+        out_font.close();
+        out_font.clear();
+        std::cout << "\nEnter anixt, binary or header Font File path  : ";
+        std::cin >> path;
+        out_path = path;
+
+        if ( in_path.extension() == ".json" && out_path.extension() == ".json" )
+        {
+            std::cout << "\nanixt Font can only be converted to binary(.abf) or header(.hpp) Font\n";
+            continue;
+        }
+
+        out_font.open( path, std::ios_base::binary );
+
+    } while ( !out_font.is_open() );
+
+    if ( in_path.extension() == ".json" )
+    {
+        in_font >> abf;
+    }
+    else
+    {
+        in_font >> flf;
+        flf.update();
+        abf.update( flf.get_json_font() );
+    }
+
+    if ( out_path.extension() == ".abf" )
+    {
+        abf.write( out_font );
+    }
+    else if ( out_path.extension() == ".hpp" )
+    {
+        abf.write_header( out_font, identifier( out_path.stem().string() ) );
+    }
+    else
+    {
+        out_font << flf;
+    }
+
+    in_font.close();
+    out_font.close();
+
+    if ( out_path.extension() == ".hpp" )
+    {
+        std::cout << "\nInclude " << out_path.filename().string() << " and use "
+                  << identifier( out_path.stem().string() ) << " as font type\n";
+    }
+    else if ( out_path.extension() == ".abf" )
+    {
+        preview<anixt_mmap_font>( path );
+    }
+    else
+    {
+        preview<anixt_json_font>( path );
+    }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -11,9 +11,22 @@
 #define ARTLIB_HEADER
 
 #include "algorithm"
+#include "memory_resource"
+#include "source/anixt_batch.hpp"
 #include "source/anixt_config.hpp"
+#include "source/anixt_flf_font.hpp"
 #include "source/anixt_font.hpp"
+#include "source/anixt_lines.hpp"
+#include "source/anixt_mmap_font.hpp"
+#include "source/anixt_renderer.hpp"
+#include "source/anixt_static_font.hpp"
 #include "source/anixt_style.hpp"
+#include "source/anixt_unicode_font.hpp"
+#include "source/artlib_canvas.hpp"
+#include "source/artlib_json.hpp"
+#include "source/artlib_registry.hpp"
+#include "source/artlib_sink.hpp"
+#include "source/artlib_unicode.hpp"
 #include "source/basic_anixt.hpp"
 #include "source/basic_runeape.hpp"
 #include "source/runeape_config.hpp"
@@ -43,6 +56,32 @@ namespace srilakshmikanthanp
          * @brief json_font type for anixt class
          **/
         using anixt_json_font           =     basic_anixt_json_font<anixt_config<char>>;
+
+        /**
+         * @brief mmap_font type for anixt class, reads
+         *        anixt binary font made by fontcvt
+         **/
+        using anixt_mmap_font           =     basic_anixt_mmap_font<anixt_config<char>>;
+
+        /**
+         * @brief flf_font type for anixt class, reads
+         *        FIGlet font without conversion
+         **/
+        using anixt_flf_font            =     basic_anixt_flf_font<anixt_config<char>>;
+
+        /**
+         * @brief unicode_font type for anixt class, reads
+         *        large FIGlet font lazily with bounded cache
+         **/
+        using anixt_unicode_font        =     basic_anixt_unicode_font<anixt_config<char>>;
+
+        /**
+         * @brief  static_font type for anixt class, reads
+         *         font compiled in from header made by fontcvt
+         * @tparam Data generated font data
+         **/
+        template <typename Data>
+        using anixt_static_font         =     basic_anixt_static_font<anixt_config<char>, Data>;
         
         /**
          * @brief anixt_untouched_style type for anixt class
@@ -69,6 +108,25 @@ namespace srilakshmikanthanp
         template <typename StyleT, typename FontT = anixt_json_font>
         using anixt                     =     basic_anixt<StyleT, FontT, anixt_config<char>>;
 
+        /**
+         * @brief  anixt_renderer, anixt without stream
+         * @tparam StyleT style type
+         * @tparam FontT font type, defaults anixt_json_font
+         **/
+        template <typename StyleT, typename FontT = anixt_json_font>
+        using anixt_renderer            =     basic_anixt_renderer<StyleT, FontT, anixt_config<char>>;
+
+        /**
+         * @brief anixt_canvas type, rows of anixt in one buffer
+         **/
+        using anixt_canvas              =     anixt_config<char>::anixt_canvas;
+
+        /**
+         * @brief anixt_batch type, anixt strings of many texts in
+         *        one buffer
+         **/
+        using anixt_batch               =     basic_anixt_batch<anixt_config<char>>;
+
         /**
          * @brief json_gallery type for runeape class
          **/
@@ -94,6 +152,142 @@ namespace srilakshmikanthanp
         template <typename StyleT, typename GalleryT = runeape_json_gallery>
         using runeape                   =     basic_runeape<StyleT, GalleryT, runeape_config<char>>;
 
+        /**
+         * @brief runeape_canvas type, rows of runeape in one buffer
+         **/
+        using runeape_canvas            =     runeape_config<char>::runeape_canvas;
+
+        /**
+         * @namespace pmr
+         * @brief     types of art that allocate by
+         *            std::pmr::polymorphic_allocator, anixt_renderer,
+         *            anixt and runeape made with allocator of a
+         *            memory resource render in to it
+         **/
+        namespace pmr
+        {
+            /**
+             * @brief anixt_config with polymorphic_allocator
+             **/
+            using anixt_config              =     art::anixt_config<char, std::size_t, std::char_traits<char>, std::pmr::polymorphic_allocator>;
+
+            /**
+             * @brief runeape_config with polymorphic_allocator
+             **/
+            using runeape_config            =     art::runeape_config<char, std::size_t, std::char_traits<char>, std::pmr::polymorphic_allocator>;
+
+            /**
+             * @brief json_font type for anixt class
+             **/
+            using anixt_json_font           =     basic_anixt_json_font<anixt_config>;
+
+            /**
+             * @brief mmap_font type for anixt class
+             **/
+            using anixt_mmap_font           =     basic_anixt_mmap_font<anixt_config>;
+
+            /**
+             * @brief flf_font type for anixt class
+             **/
+            using anixt_flf_font            =     basic_anixt_flf_font<anixt_config>;
+
+            /**
+             * @brief unicode_font type for anixt class
+             **/
+            using anixt_unicode_font        =     basic_anixt_unicode_font<anixt_config>;
+
+            /**
+             * @brief  static_font type for anixt class
+             * @tparam Data font data made by fontcvt
+             **/
+            template <typename Data>
+            using anixt_static_font         =     basic_anixt_static_font<anixt_config, Data>;
+
+            /**
+             * @brief anixt_untouched_style type for anixt class
+             **/
+            using anixt_untouched_style     =     basic_anixt_untouched_style<anixt_config>;
+
+            /**
+             * @brief  anixt_kerning_style type for anixt class
+             * @tparam Kerning kerning space
+             **/
+            template <unsigned int Kerning>
+            using anixt_kerning_style       =     basic_anixt_kerning_style<Kerning, anixt_config>;
+
+            /**
+             * @brief anixt_smushed_style type for anixt class
+             **/
+            using anixt_smushed_style       =     basic_anixt_smushed_style<anixt_config>;
+
+            /**
+             * @brief  anixt
+             * @tparam StyleT style type
+             * @tparam FontT font type, defaults pmr::anixt_json_font
+             **/
+            template <typename StyleT, typename FontT = anixt_json_font>
+            using anixt                     =     basic_anixt<StyleT, FontT, anixt_config>;
+
+            /**
+             * @brief  anixt_renderer, anixt without stream
+             * @tparam StyleT style type
+             * @tparam FontT font type, defaults pmr::anixt_json_font
+             **/
+            template <typename StyleT, typename FontT = anixt_json_font>
+            using anixt_renderer            =     basic_anixt_renderer<StyleT, FontT, anixt_config>;
+
+            /**
+             * @brief anixt_canvas type, rows of anixt in one buffer
+             **/
+            using anixt_canvas              =     anixt_config::anixt_canvas;
+
+            /**
+             * @brief anixt_batch type for anixt class
+             **/
+            using anixt_batch               =     basic_anixt_batch<anixt_config>;
+
+            /**
+             * @brief anixt_string type
+             **/
+            using anixt_string              =     anixt_config::anixt_string;
+
+            /**
+             * @brief json_gallery type for runeape class
+             **/
+            using runeape_json_gallery      =     basic_runeape_json_gallery<runeape_config>;
+
+            /**
+             * @brief runeape_untouched_style type for runeape class
+             **/
+            using runeape_untouched_style   =     basic_runeape_untouched_style<runeape_config>;
+
+            /**
+             * @brief  runeape_kerning_style type for runeape class
+             * @tparam Kerning Kerning space
+             **/
+            template <unsigned int Kerning>
+            using runeape_kerning_style     =     basic_runeape_kerning_style<Kerning, runeape_config>;
+
+            /**
+             * @brief  runeape
+             * @tparam StyleT style type
+             * @tparam GalleryT type, defaults pmr::runeape_json_gallery
+             **/
+            template <typename StyleT, typename GalleryT = runeape_json_gallery>
+            using runeape                   =     basic_runeape<StyleT, GalleryT, runeape_config>;
+
+            /**
+             * @brief runeape_canvas type, rows of runeape in one buffer
+             **/
+            using runeape_canvas            =     runeape_config::runeape_canvas;
+
+            /**
+             * @brief runeape_image type
+             **/
+            using runeape_image             =     runeape_config::runeape_image;
+
+        } // namespace pmr
+
     } // namespace art
 
 } // namespace srilakshmikanthanp
@@ -113,7 +307,7 @@ namespace srilakshmikanthanp
         template <typename Type, typename CharT>
         auto frame( const Type &obj, CharT hor, CharT ver )
         {
-            Type ret;
+            Type ret( obj.get_allocator() );
 
             if ( obj.size() )
             {
@@ -149,7 +343,7 @@ namespace srilakshmikanthanp
         template <typename Type>
         auto addtopline( const Type &obj, size_t n = 1 )
         {
-            Type ret;
+            Type ret( obj.get_allocator() );
 
             if ( obj.size() )
             {
@@ -178,7 +372,7 @@ namespace srilakshmikanthanp
         template <typename Type>
         auto addbottomline( const Type &obj, size_t n = 1 )
         {
-            Type ret;
+            Type ret( obj.get_allocator() );
 
             if ( obj.size() )
             {
@@ -199,107 +393,268 @@ namespace srilakshmikanthanp
         }
 
         /**
-         * @brief appends a anixt_string or runeape_image in right
-         * @param obj Runeape
-         * @param value value
-         * @return modified value
+         * @brief frmes the canvas in to new canvas
+         * @param obj canvas
+         * @param hor horizontal character
+         * @param ver vertical character
+         * @return framed canvas
          **/
-        template <typename Runeape, typename Type>
-        auto appendright( const Runeape &obj, const Type &value )
+        template <typename CharT, typename Traits, template <typename> typename Alloc, typename Char>
+        auto frame( const artlib_canvas<CharT, Traits, Alloc> &obj, Char hor, Char ver )
         {
-            typename Runeape::runeape_config::runeape_image ret;
-            typename Runeape::runeape_config::runeape_image rimg;
-            Type                                            val;
+            artlib_canvas<CharT, Traits, Alloc> ret( obj.get_allocator() );
+
+            if ( obj.size() )
+            {
+                ret.assign( obj.width() + 4, obj.height() + 2, obj.width() + 4 );
 
-            rimg = obj.get_runeape_image();
-            val  = value;
+                Traits::assign( ret.row_data( 0 ), ret.width(), hor );
+                Traits::assign( ret.row_data( ret.height() - 1 ), ret.width(), hor );
+
+                for ( size_t i = 0; i < obj.height(); i++ )
+                {
+                    CharT *row = ret.row_data( i + 1 );
+
+                    row[0]               = ver;
+                    row[ret.width() - 1] = ver;
+
+                    Traits::copy( row + 2, obj.row_data( i ), obj.width() );
+                }
+            }
+
+            return ret;
+        }
+
+        /**
+         * @brief adds a line in top in canvas
+         * @param obj canvas
+         * @param n   lines, defults to 1
+         * @return modified canvas
+         **/
+        template <typename CharT, typename Traits, template <typename> typename Alloc>
+        auto addtopline( const artlib_canvas<CharT, Traits, Alloc> &obj, size_t n = 1 )
+        {
+            artlib_canvas<CharT, Traits, Alloc> ret( obj.get_allocator() );
 
-            if ( rimg.size() < val.size() )
+            if ( obj.size() )
             {
-                size_t diff = val.size() - rimg.size();
-                rimg        = addbottomline( rimg, diff );
+                ret.assign( obj.width(), obj.height() + n, obj.width() );
+
+                for ( size_t i = 0; i < obj.height(); i++ )
+                {
+                    Traits::copy( ret.row_data( i + n ), obj.row_data( i ), obj.width() );
+                }
             }
-            else if ( rimg.size() > val.size() )
+
+            return ret;
+        }
+
+        /**
+         * @brief adds a line in bottom in canvas
+         * @param obj canvas
+         * @param n   lines, defults to 1
+         * @return modified canvas
+         **/
+        template <typename CharT, typename Traits, template <typename> typename Alloc>
+        auto addbottomline( const artlib_canvas<CharT, Traits, Alloc> &obj, size_t n = 1 )
+        {
+            artlib_canvas<CharT, Traits, Alloc> ret( obj.get_allocator() );
+
+            if ( obj.size() )
             {
-                size_t diff = rimg.size() - val.size();
-                val         = addbottomline( val, diff );
+                ret.assign( obj.width(), obj.height() + n, obj.width() );
+
+                for ( size_t i = 0; i < obj.height(); i++ )
+                {
+                    Traits::copy( ret.row_data( i ), obj.row_data( i ), obj.width() );
+                }
             }
 
-            std::vector<typename Runeape::runeape_config::runeape_image> rimgs;
-            rimgs.resize( 2, typename Runeape::runeape_config::runeape_image() );
+            return ret;
+        }
+
+        /**
+         * @struct artlib_glyph_buffer
+         * @brief  packs rows of anixt_string, runeape_image or canvas to
+         *         view them as runeape_glyph, rows are padded to
+         *         width of widest row
+         * @tparam Runeapeconfig type of runeape_config
+         **/
+        template <typename Runeapeconfig>
+        struct artlib_glyph_buffer
+        {
+            using allocator_type = typename Runeapeconfig::allocator_type;
+            using size_type      = typename Runeapeconfig::size_type;
+            using string_type    = typename Runeapeconfig::string_type;
+            using runeape_glyph  = typename Runeapeconfig::runeape_glyph;
+            template <typename T>
+            using vector_type = typename Runeapeconfig::template vector_type<T>;
+
+            string_type            rows;
+            vector_type<size_type> left, right;
+            size_type              width { 0 };
+            size_type              height { 0 };
+
+            /**
+             * @brief constructor
+             * @param obj anixt_string, runeape_image or canvas
+             **/
+            template <typename Type>
+            explicit artlib_glyph_buffer( const Type &obj )
+                : artlib_glyph_buffer( obj, obj.size(), allocator_type() )
+            {
+            }
 
-            for ( const auto &i : rimg )
+            /**
+             * @brief constructor, rows after rows of obj are blank
+             *        till height
+             * @param obj anixt_string, runeape_image or canvas
+             * @param height number of rows, not less than rows of obj
+             * @param alloc allocator of buffers
+             **/
+            template <typename Type>
+            artlib_glyph_buffer( const Type &obj, size_type height, const allocator_type &alloc )
+                : rows( alloc ),
+                  left( alloc ),
+                  right( alloc ),
+                  height( height )
             {
-                rimgs[0].push_back( i );
+                for ( const auto &i : obj )
+                {
+                    this->width = std::max<size_type>( this->width, i.size() );
+                }
+
+                this->rows.reserve( this->width * this->height );
+
+                for ( const auto &i : obj )
+                {
+                    this->rows.append( i.begin(), i.end() );
+                    this->rows.append( this->width - i.size(), ' ' );
+                }
+
+                this->rows.append( this->width * ( this->height - obj.size() ), ' ' );
+
+                artlib_edges( this->rows.data(), this->width, this->height, this->left, this->right );
             }
 
-            for ( const auto &i : val )
+            /**
+             * @brief  view of rows
+             * @return runeape_glyph
+             **/
+            runeape_glyph glyph() const noexcept
             {
-                rimgs[1].push_back( i );
+                return runeape_glyph { this->rows.data(), this->width, this->height,
+                                       this->left.data(), this->right.data() };
             }
+        };
 
-            typename Runeape::style_type     style;
-            typename Runeape::runeape_config config;
+        /**
+         * @brief renders runeape and value side by side in to canvas
+         *        by style of runeape, shorter of them is padded with
+         *        blank rows at bottom. buffers are allocated by
+         *        allocator of canvas
+         * @param obj Runeape
+         * @param value anixt_string, runeape_image or canvas
+         * @param canvas runeape_canvas to render in
+         * @param left true if value is in left of runeape
+         **/
+        template <typename Runeape, typename Type>
+        void artlib_append( const Runeape &obj, const Type &value,
+                            typename Runeape::runeape_config::runeape_canvas &canvas, bool left )
+        {
+            using config_type = typename Runeape::runeape_config;
+            using glyph_type  = typename config_type::runeape_glyph;
+            using buffer_type = artlib_glyph_buffer<config_type>;
+
+            auto alloc = canvas.get_allocator();
+
+            typename config_type::runeape_canvas rimg( alloc );
+
+            obj.get_runeape_canvas( rimg );
+
+            size_t height = std::max<size_t>( rimg.height(), value.size() );
+
+            buffer_type rimg_buff( rimg, height, alloc );
+            buffer_type val_buff( value, height, alloc );
+
+            typename config_type::template vector_type<glyph_type> rimgs( alloc );
+
+            rimgs.push_back( left ? val_buff.glyph() : rimg_buff.glyph() );
+            rimgs.push_back( left ? rimg_buff.glyph() : val_buff.glyph() );
+
+            typename Runeape::style_type style( alloc );
+            config_type                  config;
             config           = obj.get_runeape_config();
             config.HardBlank = '\0';
-            config.Height    = rimg.size();
+            config.Height    = height;
 
             style.set_config( config );
 
-            ret = style( rimgs );
-
-            return ret;
+            style( rimgs, canvas );
         }
 
         /**
-         * @brief appends a anixt_string or runeape_image in left
+         * @brief appends a anixt_string, runeape_image or canvas in
+         *        right of runeape in to canvas, buffer of canvas is
+         *        reused
          * @param obj Runeape
          * @param value value
-         * @return modified value
+         * @param canvas runeape_canvas to render in
          **/
         template <typename Runeape, typename Type>
-        auto appendleft( const Runeape &obj, const Type &value )
+        void appendright( const Runeape &obj, const Type &value, typename Runeape::runeape_config::runeape_canvas &canvas )
         {
-            typename Runeape::runeape_config::runeape_image ret;
-            typename Runeape::runeape_config::runeape_image rimg;
-            Type                                            val;
+            artlib_append( obj, value, canvas, false );
+        }
 
-            rimg = obj.get_runeape_image();
-            val  = value;
+        /**
+         * @brief appends a anixt_string, runeape_image or canvas in
+         *        left of runeape in to canvas, buffer of canvas is
+         *        reused
+         * @param obj Runeape
+         * @param value value
+         * @param canvas runeape_canvas to render in
+         **/
+        template <typename Runeape, typename Type>
+        void appendleft( const Runeape &obj, const Type &value, typename Runeape::runeape_config::runeape_canvas &canvas )
+        {
+            artlib_append( obj, value, canvas, true );
+        }
 
-            if ( rimg.size() < val.size() )
-            {
-                size_t diff = val.size() - rimg.size();
-                rimg        = addbottomline( rimg, diff );
-            }
-            else if ( rimg.size() > val.size() )
-            {
-                size_t diff = rimg.size() - val.size();
-                val         = addbottomline( val, diff );
-            }
+        /**
+         * @brief appends a anixt_string or runeape_image in right
+         * @param obj Runeape
+         * @param value value
+         * @return modified value
+         **/
+        template <typename Runeape, typename Type>
+        auto appendright( const Runeape &obj, const Type &value )
+        {
+            typename Runeape::runeape_config::runeape_canvas canvas( obj.get_allocator() );
+            typename Runeape::runeape_config::runeape_image  ret( obj.get_allocator() );
 
-            std::vector<typename Runeape::runeape_config::runeape_image> rimgs;
-            rimgs.resize( 2, typename Runeape::runeape_config::runeape_image() );
+            appendright( obj, value, canvas );
 
-            for ( const auto &i : rimg )
-            {
-                rimgs[1].push_back( i );
-            }
+            canvas.to( ret );
 
-            for ( const auto &i : val )
-            {
-                rimgs[0].push_back( i );
-            }
+            return ret;
+        }
 
-            typename Runeape::style_type     style;
-            typename Runeape::runeape_config config;
-            config           = obj.get_runeape_config();
-            config.HardBlank = '\0';
-            config.Height    = rimg.size();
+        /**
+         * @brief appends a anixt_string or runeape_image in left
+         * @param obj Runeape
+         * @param value value
+         * @return modified value
+         **/
+        template <typename Runeape, typename Type>
+        auto appendleft( const Runeape &obj, const Type &value )
+        {
+            typename Runeape::runeape_config::runeape_canvas canvas( obj.get_allocator() );
+            typename Runeape::runeape_config::runeape_image  ret( obj.get_allocator() );
 
-            style.set_config( config );
+            appendleft( obj, value, canvas );
 
-            ret = style( rimgs );
+            canvas.to( ret );
 
             return ret;
         }
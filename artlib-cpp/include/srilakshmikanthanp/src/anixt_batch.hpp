@@ -0,0 +1,278 @@
+///@file anixt_batch.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_BATCH_HEADER
+#define ANIXT_BATCH_HEADER
+
+#include "anixt_config.hpp"
+#include "utility"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  basic_anixt_batch
+         * @brief  anixt strings of many texts packed in one buffer,
+         *         rows of item are width chars ended by newline one
+         *         after other from offset of item, so buffer is text
+         *         of all items. buffers are kept by clear so batch
+         *         that is reused does not allocate once it is large
+         *         enough
+         * @tparam Anixtconfig anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_batch
+        {
+           public:
+            using anixt_config   = Anixtconfig;
+            using allocator_type = typename anixt_config::allocator_type;
+
+           private:
+            using char_type        = typename anixt_config::char_type;
+            using size_type        = typename anixt_config::size_type;
+            using traits_type      = typename anixt_config::traits_type;
+            using string_type      = typename anixt_config::string_type;
+            using string_view_type = typename anixt_config::string_view_type;
+            using anixt_extent     = typename anixt_config::anixt_extent;
+            using anixt_canvas     = typename anixt_config::anixt_canvas;
+            template <typename T>
+            using vector_type = typename anixt_config::template vector_type<T>;
+
+           public:
+            /**
+             * @struct entry
+             * @brief  offset of first row of item in buffer and its
+             *         width and height
+             **/
+            struct entry
+            {
+                size_type offset;
+                size_type width;
+                size_type height;
+            };
+
+           private:
+            string_type        buffer;
+            vector_type<entry> entries;
+
+           public:
+            basic_anixt_batch()                                = default;
+            basic_anixt_batch( const basic_anixt_batch & )     = default;
+            basic_anixt_batch( basic_anixt_batch && ) noexcept = default;
+            ~basic_anixt_batch()                               = default;
+
+            basic_anixt_batch &operator=( const basic_anixt_batch & ) = default;
+            basic_anixt_batch &operator=( basic_anixt_batch && ) noexcept = default;
+
+            /**
+             * @brief constructor, buffer and entries are allocated
+             *        by alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_batch( const allocator_type &alloc )
+                : buffer( alloc ),
+                  entries( alloc )
+            {
+            }
+
+            /**
+             * @brief  allocator of batch
+             * @return allocator
+             **/
+            allocator_type get_allocator() const noexcept
+            {
+                return this->buffer.get_allocator();
+            }
+
+            /**
+             * @brief clears items, buffers are kept
+             **/
+            void clear() noexcept
+            {
+                this->buffer.clear();
+                this->entries.clear();
+            }
+
+            /**
+             * @brief swap two basic_anixt_batch
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_batch &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->buffer, obj.buffer );
+                swap( this->entries, obj.entries );
+            }
+
+            /**
+             * @brief reserves buffer and entries
+             * @param chars number of chars of all rows
+             * @param count number of items
+             **/
+            void reserve( size_type chars, size_type count )
+            {
+                this->buffer.reserve( chars );
+                this->entries.reserve( count );
+            }
+
+            /**
+             * @brief appends rows of canvas as item
+             * @param canvas anixt_canvas of item
+             **/
+            void push_back( const anixt_canvas &canvas )
+            {
+                size_type offset = this->buffer.size();
+                size_type width  = canvas.width();
+                size_type height = canvas.height();
+
+                this->buffer.resize( offset + height * ( width + 1 ) );
+
+                char_type *out = &this->buffer[offset];
+
+                for ( size_type i = 0; i < height; i++ )
+                {
+                    traits_type::copy( out, canvas.row_data( i ), width );
+                    out[width] = char_type( '\n' );
+                    out += width + 1;
+                }
+
+                this->entries.push_back( entry { offset, width, height } );
+            }
+
+            /**
+             * @brief appends item of extent, its rows are spaces
+             *        ended by newline till they are written in to
+             *        slot of item
+             * @param extent width and height of item
+             **/
+            void push_back( const anixt_extent &extent )
+            {
+                size_type offset = this->buffer.size();
+                size_type width  = extent.width;
+
+                this->buffer.resize( offset + extent.height * ( width + 1 ), char_type( ' ' ) );
+
+                for ( size_type i = 0; i < extent.height; i++ )
+                {
+                    this->buffer[offset + i * ( width + 1 ) + width] = char_type( '\n' );
+                }
+
+                this->entries.push_back( entry { offset, width, extent.height } );
+            }
+
+            /**
+             * @brief  rows of item to write in to, rows are width
+             *         chars ended by newline
+             * @param  k index of item
+             * @return begin of rows of item
+             **/
+            char_type *slot( size_type k ) noexcept
+            {
+                return &this->buffer[0] + this->entries[k].offset;
+            }
+
+            /**
+             * @brief  number of items
+             * @return size
+             **/
+            size_type size() const noexcept
+            {
+                return this->entries.size();
+            }
+
+            /**
+             * @brief  checks batch has no items
+             * @return true if empty
+             **/
+            bool empty() const noexcept
+            {
+                return this->entries.empty();
+            }
+
+            /**
+             * @brief  entry of item
+             * @param  k index of item
+             * @return entry
+             **/
+            const entry &operator[]( size_type k ) const noexcept
+            {
+                return this->entries[k];
+            }
+
+            /**
+             * @brief  width and height of item
+             * @param  k index of item
+             * @return width and height
+             **/
+            anixt_extent extent( size_type k ) const noexcept
+            {
+                return anixt_extent { this->entries[k].width, this->entries[k].height };
+            }
+
+            /**
+             * @brief  row of item without newline
+             * @param  k index of item
+             * @param  i index of row
+             * @return view of row
+             **/
+            string_view_type row( size_type k, size_type i ) const noexcept
+            {
+                const entry &e = this->entries[k];
+
+                return string_view_type( this->buffer.data() + e.offset + i * ( e.width + 1 ), e.width );
+            }
+
+            /**
+             * @brief  rows of item with newlines
+             * @param  k index of item
+             * @return view of rows
+             **/
+            string_view_type item( size_type k ) const noexcept
+            {
+                const entry &e = this->entries[k];
+
+                return string_view_type( this->buffer.data() + e.offset, e.height * ( e.width + 1 ) );
+            }
+
+            /**
+             * @brief  rows of all items with newlines
+             * @return view of buffer
+             **/
+            string_view_type str() const noexcept
+            {
+                return string_view_type( this->buffer );
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_batch
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_batch<Anixtconfig> &lhs,
+                   basic_anixt_batch<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -10,10 +10,12 @@
 #ifndef ANIXTCONFIG_HEADER
 #define ANIXTCONFIG_HEADER
 
+#include "artlib_canvas.hpp"
 #include "artlib_data.hpp"
 #include "memory"
 #include "ostream"
 #include "string"
+#include "string_view"
 #include "type_traits"
 #include "vector"
 
@@ -49,10 +51,22 @@ namespace srilakshmikanthanp
             using traits_type = Traits;
             template <typename T>
             using alloc_type  = Alloc<T>;
+            using allocator_type = Alloc<CharT>;
             using string_type = std::basic_string<CharT, Traits, Alloc<CharT>>;
+            using string_view_type = std::basic_string_view<CharT, Traits>;
             template <typename T>
             using vector_type = std::vector<T, Alloc<T>>;
 
+            /**
+             * @brief anixt canvas type, rows in one buffer
+             **/
+            using anixt_canvas = artlib_canvas<CharT, Traits, Alloc>;
+
+            /**
+             * @brief width and height of anixt canvas
+             **/
+            using anixt_extent = artlib_extent<SizeT>;
+
             /**
              * @struct anixt_letter
              * @brief  anixt letter type
@@ -63,6 +77,50 @@ namespace srilakshmikanthanp
                 using base::base;
             };
 
+            /**
+             * @struct anixt_glyph
+             * @brief  view of letter in font, rows are height
+             *         rows of width one after other in font
+             *         storage, left and right are edges of rows
+             *         found at load(see artlib_edges), valid as
+             *         long as font is alive. code is codepoint of
+             *         letter, smushed style uses it to cache fit
+             *         of pairs of letters, no_code if it is not known
+             **/
+            struct anixt_glyph
+            {
+                /**
+                 * @brief code of glyph not taken from font
+                 **/
+                static constexpr char32_t no_code = char32_t( -1 );
+
+                const char_type *rows { nullptr };
+                size_type        width { 0 };
+                size_type        height { 0 };
+                const size_type *left { nullptr };
+                const size_type *right { nullptr };
+                char32_t         code { no_code };
+
+                /**
+                 * @brief  number of rows
+                 * @return height
+                 **/
+                size_type size() const noexcept
+                {
+                    return this->height;
+                }
+
+                /**
+                 * @brief  row of glyph
+                 * @param  i index of row
+                 * @return view of row
+                 **/
+                string_view_type operator[]( size_type i ) const noexcept
+                {
+                    return string_view_type( this->rows + i * this->width, this->width );
+                }
+            };
+
             /**
              * @struct anixt_string
              * @brief  anixt string type
@@ -102,6 +160,13 @@ namespace srilakshmikanthanp
              *        see @ref shrink
              **/
             shrink Shrink;
+            /**
+             * @brief stores FIGlet full layout of font, horizontal
+             *        smush rules are bits 0 to 5, fitting is bit 6
+             *        and smushing is bit 7. -1 if font has no layout,
+             *        rules of artlib are used then
+             **/
+            long Layout { -1 };
 
             anixt_config()                           = default;
             anixt_config( const anixt_config & )     = default;
@@ -115,13 +180,15 @@ namespace srilakshmikanthanp
              * @brief clears the configuraton,
              *        sets HardBlank to 0,
              *        Height to 0,
-             *        Shrink to level_0
+             *        Shrink to level_0,
+             *        Layout to -1
              **/
             void clear() noexcept
             {
                 this->HardBlank = 0;
                 this->Height    = 0;
                 this->Shrink    = shrink::level_0;
+                this->Layout    = -1;
             }
 
             /**
@@ -134,6 +201,7 @@ namespace srilakshmikanthanp
                 swap( this->HardBlank, obj.HardBlank );
                 swap( this->Height, obj.Height );
                 swap( this->Shrink, obj.Shrink );
+                swap( this->Layout, obj.Layout );
             }
 
             /**
@@ -0,0 +1,593 @@
+///@file anixt_flf_font.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_FLF_FONT_HEADER
+#define ANIXT_FLF_FONT_HEADER
+
+#include "algorithm"
+#include "anixt_font.hpp"
+#include "cstring"
+#include "filesystem"
+#include "fstream"
+#include "limits"
+#include "string"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class anixt_flf_scanner
+         * @brief splits FIGlet font(.flf) in to lines without
+         *        copying and reads header and letters of it, line
+         *        breaks are \n or \r\n
+         **/
+        class anixt_flf_scanner
+        {
+           public:
+            /**
+             * @struct header_type
+             * @brief  values of first line of FIGlet font
+             **/
+            struct header_type
+            {
+                char hardblank;
+                long height;
+                long old_layout;
+                long full_layout;
+            };
+
+           private:
+            const char *first;
+            const char *pos;
+            const char *last;
+
+           public:
+            /**
+             * @brief constructor
+             * @param data file contents
+             * @param size size of contents
+             **/
+            anixt_flf_scanner( const char *data, std::size_t size ) noexcept
+                : first( data ), pos( data ), last( data + size )
+            {
+            }
+
+            /**
+             * @brief  offset of next line from begin of file
+             * @return offset
+             **/
+            std::size_t tell() const noexcept
+            {
+                return static_cast<std::size_t>( this->pos - this->first );
+            }
+
+            /**
+             * @brief moves to offset from begin of file
+             * @param off offset
+             **/
+            void seek( std::size_t off ) noexcept
+            {
+                this->pos = this->first + std::min<std::size_t>( off, this->last - this->first );
+            }
+
+            /**
+             * @brief  gets next line
+             * @param  begin begin of line
+             * @param  end end of line
+             * @return false if no more lines
+             **/
+            bool next( const char *&begin, const char *&end ) noexcept
+            {
+                if ( this->pos == this->last )
+                {
+                    return false;
+                }
+
+                const void *nl = std::memchr( this->pos, '\n', this->last - this->pos );
+
+                begin     = this->pos;
+                end       = nl ? static_cast<const char *>( nl ) : this->last;
+                this->pos = nl ? end + 1 : this->last;
+
+                if ( end != begin && *( end - 1 ) == '\r' )
+                {
+                    --end;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief  checks character is white space as isspace of
+             *         C locale
+             * @param  c character
+             * @return true if white space
+             **/
+            static constexpr bool space( char c ) noexcept
+            {
+                return c == ' ' || ( c >= '\t' && c <= '\r' );
+            }
+
+            /**
+             * @brief  value of digit in base 16
+             * @param  c character
+             * @return value, 16 if c is not digit
+             **/
+            static constexpr int digit( char c ) noexcept
+            {
+                return c >= '0' && c <= '9'   ? c - '0'
+                       : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                       : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                              : 16;
+            }
+
+            /**
+             * @brief  reads integer from text in place, decimal,
+             *         octal(0) and hex(0x) as strtol does in FIGlet,
+             *         value out of range of long is clamped
+             * @param  str text, moved past the number
+             * @param  end end of text
+             * @param  val value read
+             * @return false if there is no number
+             **/
+            static bool read_int( const char *&str, const char *end, long &val ) noexcept
+            {
+                const char *it = str;
+
+                while ( it != end && space( *it ) )
+                {
+                    ++it;
+                }
+
+                bool negative = it != end && *it == '-';
+
+                if ( it != end && ( *it == '-' || *it == '+' ) )
+                {
+                    ++it;
+                }
+
+                int base = it != end && *it == '0' ? 8 : 10;
+
+                if ( base == 8 && end - it > 2 && ( it[1] == 'x' || it[1] == 'X' ) && digit( it[2] ) < 16 )
+                {
+                    base = 16;
+                    it += 2;
+                }
+
+                unsigned long limit  = static_cast<unsigned long>( std::numeric_limits<long>::max() ) + ( negative ? 1 : 0 );
+                unsigned long num    = 0;
+                const char *  digits = it;
+
+                for ( ; it != end && digit( *it ) < base; ++it )
+                {
+                    unsigned long d = static_cast<unsigned long>( digit( *it ) );
+
+                    num = num > ( limit - d ) / static_cast<unsigned long>( base ) ? limit : num * base + d;
+                }
+
+                if ( it == digits )
+                {
+                    return false;
+                }
+
+                val = negative ? static_cast<long>( 0 - num ) : static_cast<long>( num );
+                str = it;
+
+                return true;
+            }
+
+            /**
+             * @brief  reads header and skips comment lines
+             * @return header
+             **/
+            header_type header()
+            {
+                const char *begin, *end;
+
+                if ( !this->next( begin, end ) || end - begin < 6 || std::strncmp( begin, "flf2a", 5 ) != 0 )
+                {
+                    throw std::runtime_error( "Invalid flf header" );
+                }
+
+                const char *str = begin + 6;
+                long        baseline, max_length, comments, direction;
+                header_type head { begin[5], 0, 0, -1 };
+
+                if ( !read_int( str, end, head.height ) || !read_int( str, end, baseline ) ||
+                     !read_int( str, end, max_length ) || !read_int( str, end, head.old_layout ) ||
+                     !read_int( str, end, comments ) || head.height <= 0 || comments < 0 )
+                {
+                    throw std::runtime_error( "Invalid flf header" );
+                }
+
+                if ( read_int( str, end, direction ) )
+                {
+                    read_int( str, end, head.full_layout );
+                }
+
+                for ( long i = 0; i < comments; i++ )
+                {
+                    if ( !this->next( begin, end ) )
+                    {
+                        throw std::runtime_error( "Invalid flf file" );
+                    }
+                }
+
+                return head;
+            }
+
+            /**
+             * @brief  full layout of header, old layout is turned
+             *         in to full layout if header has no full layout
+             * @param  head header
+             * @return full layout
+             **/
+            static long full_layout( const header_type &head ) noexcept
+            {
+                if ( head.full_layout >= 0 )
+                {
+                    return head.full_layout & 32767;
+                }
+
+                return head.old_layout > 0 ? 128 | ( head.old_layout & 63 ) : head.old_layout == 0 ? 64 : 0;
+            }
+
+            /**
+             * @brief  FIGlet layout to Shrink level
+             * @param  head header
+             * @return Shrink level as 0, 1 or 2
+             **/
+            static unsigned int shrink_level( const header_type &head ) noexcept
+            {
+                long layout = full_layout( head );
+
+                return ( layout & 128 ) ? 2 : ( layout & 64 ) ? 1 : 0;
+            }
+
+            /**
+             * @brief  reads rows of one letter, endmarks are
+             *         stripped
+             * @param  height Height of font
+             * @param  lines begin and end of rows
+             * @return width of widest row, npos if file ended
+             **/
+            template <typename Vector>
+            std::size_t rows( std::size_t height, Vector &lines ) noexcept
+            {
+                std::size_t width = 0;
+
+                for ( std::size_t i = 0; i < height; i++ )
+                {
+                    const char *begin, *end;
+
+                    if ( !this->next( begin, end ) )
+                    {
+                        return std::string::npos;
+                    }
+
+                    // white space after endmark is dropped as in
+                    // FIGlet, last character is then the endmark, it
+                    // may be repeated on the last row of letter
+                    while ( end != begin && space( *( end - 1 ) ) )
+                    {
+                        --end;
+                    }
+
+                    if ( begin != end )
+                    {
+                        const char mark = *( end - 1 );
+
+                        while ( end != begin && *( end - 1 ) == mark )
+                        {
+                            --end;
+                        }
+                    }
+
+                    lines[i * 2]     = begin;
+                    lines[i * 2 + 1] = end;
+                    width            = std::max( width, static_cast<std::size_t>( end - begin ) );
+                }
+
+                return width;
+            }
+
+            /**
+             * @brief  calls fn with code of each letter in file
+             *         order, printable ascii then deutsch then code
+             *         tagged letters. fn is called on first row of
+             *         the letter and should read its rows
+             * @param  fn callable as bool(long code), returns
+             *         false if file ended
+             **/
+            template <typename Function>
+            void letters( Function fn )
+            {
+                static constexpr long deutsch[] = { 196, 214, 220, 228, 246, 252, 223 };
+
+                for ( long code = 32; code < 127; code++ )
+                {
+                    if ( !fn( code ) )
+                    {
+                        throw std::runtime_error( "Letter not found in font" );
+                    }
+                }
+
+                for ( long code : deutsch )
+                {
+                    if ( !fn( code ) )
+                    {
+                        return;
+                    }
+                }
+
+                const char *begin, *end;
+
+                while ( this->next( begin, end ) )
+                {
+                    long code;
+
+                    if ( !read_int( begin, end, code ) || !fn( code ) )
+                    {
+                        return;
+                    }
+                }
+            }
+        };
+
+        /**
+         * @class  basic_anixt_flf_font
+         * @brief  This class reads FIGlet font(.flf) for anixt
+         *         class straight from file without conversion
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_flf_font : public basic_anixt_base_font<Anixtconfig>
+        {
+           protected:
+            using base = basic_anixt_base_font<Anixtconfig>;
+
+           public:
+            using anixt_config = typename base::anixt_config;
+
+           private:
+            using char_type    = typename base::anixt_config::char_type;
+            using size_type    = typename base::anixt_config::size_type;
+            using string_type  = typename base::anixt_config::string_type;
+            using shrink_type  = typename base::anixt_config::shrink;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
+            template <typename T>
+            using vector_type = typename base::anixt_config::template vector_type<T>;
+
+           private:
+            /**
+             * @brief stores anixt_config of font
+             **/
+            anixt_config config {};
+
+            /**
+             * @brief stores decoded letters
+             **/
+            basic_anixt_letter_table<Anixtconfig> table;
+
+            /**
+             * @brief true if font is validated
+             **/
+            bool valid { false };
+
+            /**
+             * @brief  reads rows of one letter and adds it to
+             *         table, rows are padded to width of widest row
+             * @param  scan scanner
+             * @param  code code of letter
+             * @param  lines scratch for begin and end of rows
+             * @return false if file ended
+             **/
+            bool read_letter( anixt_flf_scanner &scan, long code, vector_type<const char *> &lines )
+            {
+                size_type height = this->config.Height;
+
+                lines.resize( height * 2 );
+
+                std::size_t width = scan.rows( height, lines );
+
+                if ( width == std::string::npos )
+                {
+                    return false;
+                }
+
+                if ( code < 0 || static_cast<unsigned long>( code ) > artlib_page_table<size_type>::max_code )
+                {
+                    return true;
+                }
+
+                string_type &rows   = this->table.buffer();
+                size_type    offset = rows.size();
+
+                for ( size_type i = 0; i < height; i++ )
+                {
+                    const char *begin = lines[i * 2];
+                    const char *end   = lines[i * 2 + 1];
+
+                    for ( const char *c = begin; c != end; ++c )
+                    {
+                        rows.push_back( static_cast<char_type>( static_cast<unsigned char>( *c ) ) );
+                    }
+
+                    rows.append( width - static_cast<size_type>( end - begin ), char_type( ' ' ) );
+                }
+
+                this->table.insert( static_cast<char32_t>( code ), offset, width, height );
+
+                return true;
+            }
+
+            /**
+             * @brief parses font from buffer
+             * @param data file contents
+             **/
+            void parse( const std::string &data )
+            {
+                anixt_flf_scanner scan( data.data(), data.size() );
+
+                anixt_flf_scanner::header_type head = scan.header();
+
+                this->config.HardBlank = static_cast<char_type>( static_cast<unsigned char>( head.hardblank ) );
+                this->config.Height    = static_cast<size_type>( head.height );
+                this->config.Shrink    = static_cast<shrink_type>( anixt_flf_scanner::shrink_level( head ) );
+                this->config.Layout    = anixt_flf_scanner::full_layout( head );
+
+                // file size bounds the rows of all letters
+                vector_type<const char *> lines;
+                this->table.buffer().reserve( data.size() );
+
+                scan.letters( [&]( long code ) { return this->read_letter( scan, code, lines ); } );
+            }
+
+           public:
+            basic_anixt_flf_font()                                   = default;
+            basic_anixt_flf_font( const basic_anixt_flf_font & )     = default;
+            basic_anixt_flf_font( basic_anixt_flf_font && ) noexcept = default;
+            ~basic_anixt_flf_font()                                  = default;
+
+            basic_anixt_flf_font &operator=( const basic_anixt_flf_font & ) = default;
+            basic_anixt_flf_font &operator=( basic_anixt_flf_font && ) noexcept = default;
+
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept override
+            {
+                this->config.clear();
+                this->table.clear();
+                this->valid = false;
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_flf_font &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->config, obj.config );
+                swap( this->table, obj.table );
+                swap( this->valid, obj.valid );
+            }
+
+            /**
+             * @brief used to set font file, call this before
+             *        any other operation. file is read at once
+             *        and letters are decoded straight in to table.
+             * @param fp full path to flf font file
+             **/
+            void set_font( const std::filesystem::path &fp ) override
+            {
+                if ( fp.extension() != ".flf" )
+                {
+                    throw std::runtime_error( "File should be flf" );
+                }
+
+                std::ifstream file { fp, std::ios_base::binary | std::ios_base::ate };
+
+                if ( !file.is_open() )
+                {
+                    throw std::runtime_error( "Unable to open file" );
+                }
+
+                std::string data( static_cast<std::size_t>( file.tellg() ), '\0' );
+
+                file.seekg( 0 );
+
+                if ( !file.read( &data[0], data.size() ) )
+                {
+                    throw std::runtime_error( "Unable to read file" );
+                }
+
+                this->clear();
+
+                try
+                {
+                    this->parse( data );
+
+                    artlib_validate_config( this->config, shrink_type::level_2 );
+                    this->table.validate( this->config.Height );
+                    this->valid = true;
+                }
+                catch ( ... )
+                {
+                    this->clear();
+                    throw;
+                }
+            }
+
+            /**
+             * @brief  used to get anixt_config
+             * @return anixt_config
+             **/
+            anixt_config get_anixt_config() const override
+            {
+                return this->config;
+            }
+
+            /**
+             * @brief  tells font is validated at load
+             * @return true if validated
+             **/
+            bool validated() const noexcept override
+            {
+                return this->valid;
+            }
+
+            /**
+             * @brief used to get anixt_glyph from font
+             * @param key key letter
+             * @return anixt_glyph
+             **/
+            anixt_glyph operator()( char_type key ) const override
+            {
+                return this->table.glyph( static_cast<std::make_unsigned_t<char_type>>( key ), this->config.Height );
+            }
+
+            /**
+             * @brief used to get anixt_glyph of codepoint from font
+             * @param code codepoint
+             * @return anixt_glyph
+             **/
+            anixt_glyph get_anixt_glyph( char32_t code ) const override
+            {
+                return this->table.glyph( code, this->config.Height );
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_flf_font
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_flf_font<Anixtconfig> &lhs,
+                   basic_anixt_flf_font<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -10,10 +10,13 @@
 #ifndef BASIC_FONT_HEADER
 #define BASIC_FONT_HEADER
 
+#include "algorithm"
 #include "anixt_config.hpp"
 #include "filesystem"
 #include "fstream"
-#include "third_party/json/json.hpp"
+#include "artlib_json.hpp"
+#include "artlib_unicode.hpp"
+#include "limits"
 #include "map"
 
 /**
@@ -32,7 +35,10 @@ namespace srilakshmikanthanp
         /**
          * @struct basic_anixt_base_font
          * @brief  abstract class for font types that used
-         *         by anixt class
+         *         by anixt class. font is shared by renderers
+         *         so get_anixt_config and operator() are const,
+         *         fonts that override non const ones should be
+         *         made const
          * @tparam Anixtconfig type of anixt_config
          **/
         template <typename Anixtconfig>
@@ -64,18 +70,273 @@ namespace srilakshmikanthanp
              * @brief  used to get anixt config from font file
              * @return anixt_config
              **/
-            virtual anixt_config get_anixt_config() = 0;
+            virtual anixt_config get_anixt_config() const = 0;
 
             /**
-             * @brief used to get key equivalent of anixt_letter
-             *        from font
+             * @brief used to get key equivalent of anixt_glyph
+             *        from font, glyph refers font storage
              * @param key key letter
-             * @return anixt_letter
+             * @return anixt_glyph
              **/
-            virtual typename anixt_config::anixt_letter
-            operator()( typename anixt_config::char_type key ) = 0;
+            virtual typename anixt_config::anixt_glyph
+            operator()( typename anixt_config::char_type key ) const = 0;
+
+            /**
+             * @brief used to get codepoint equivalent of anixt_glyph
+             *        from font, defaults to key of same code unit
+             * @param code codepoint
+             * @return anixt_glyph
+             **/
+            virtual typename anixt_config::anixt_glyph
+            get_anixt_glyph( char32_t code ) const
+            {
+                using unsigned_type = std::make_unsigned_t<typename anixt_config::char_type>;
+
+                if ( code > std::numeric_limits<unsigned_type>::max() )
+                {
+                    throw std::runtime_error( "Letter not found in font" );
+                }
+
+                typename anixt_config::anixt_glyph ret = ( *this )( static_cast<typename anixt_config::char_type>( code ) );
+
+                ret.code = code;
+
+                return ret;
+            }
+
+            /**
+             * @brief  tells font is validated at load, glyphs of
+             *         validated font are Height rows and need no
+             *         check at render
+             * @return true if validated
+             **/
+            virtual bool validated() const noexcept
+            {
+                return false;
+            }
+
+            /**
+             * @brief pins glyphs taken from font, glyphs taken
+             *        after pin are valid till matching unpin
+             *        even if font caches them
+             **/
+            virtual void pin() const
+            {
+            }
+
+            /**
+             * @brief unpins glyphs pinned by pin
+             **/
+            virtual void unpin() const noexcept
+            {
+            }
+        };
+
+        /**
+         * @class  artlib_pin_guard
+         * @brief  pins font for life time of guard
+         * @tparam FontT font type
+         **/
+        template <typename FontT>
+        class artlib_pin_guard
+        {
+           private:
+            const FontT &font;
+
+           public:
+            explicit artlib_pin_guard( const FontT &font )
+                : font( font )
+            {
+                this->font.pin();
+            }
+
+            artlib_pin_guard( const artlib_pin_guard & ) = delete;
+            artlib_pin_guard &operator=( const artlib_pin_guard & ) = delete;
+
+            ~artlib_pin_guard()
+            {
+                this->font.unpin();
+            }
+        };
+
+        /**
+         * @class  basic_anixt_letter_table
+         * @brief  letters of font decoded in to one string, rows
+         *         of a letter are stored one after other in equal
+         *         width, letters are indexed by codepoint through
+         *         two level page table
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_letter_table
+        {
+           public:
+            using anixt_config = Anixtconfig;
+
+           private:
+            using char_type    = typename anixt_config::char_type;
+            using size_type    = typename anixt_config::size_type;
+            using string_type  = typename anixt_config::string_type;
+            using anixt_glyph  = typename anixt_config::anixt_glyph;
+            template <typename T>
+            using vector_type = typename anixt_config::template vector_type<T>;
+            using index_type  = artlib_page_table<size_type, anixt_config::template alloc_type>;
+
+           private:
+            /**
+             * @struct entry
+             * @brief  offset of letter in rows, width of letter
+             *         and offset of letter in left and right
+             **/
+            struct entry
+            {
+                size_type offset;
+                size_type width;
+                size_type edge;
+            };
+
+            /**
+             * @brief stores rows of all letters
+             **/
+            string_type rows;
+
+            /**
+             * @brief stores entry of letters
+             **/
+            vector_type<entry> entries;
+
+            /**
+             * @brief stores codepoint to index of entries
+             **/
+            index_type index;
+
+            /**
+             * @brief stores edges of rows of all letters
+             **/
+            vector_type<size_type> left, right;
+
+           public:
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept
+            {
+                this->rows.clear();
+                this->entries.clear();
+                this->index.clear();
+                this->left.clear();
+                this->right.clear();
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_letter_table &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->rows, obj.rows );
+                swap( this->entries, obj.entries );
+                swap( this->index, obj.index );
+                swap( this->left, obj.left );
+                swap( this->right, obj.right );
+            }
+
+            /**
+             * @brief  returns rows of all letters, loaders append
+             *         rows of letter here before insert
+             * @return rows
+             **/
+            string_type &buffer() noexcept
+            {
+                return this->rows;
+            }
+
+            /**
+             * @brief adds letter to table and finds edges of
+             *        its rows, letter of same codepoint is replaced
+             * @param code codepoint of letter
+             * @param off offset of letter rows in buffer
+             * @param wid width of letter
+             * @param count number of rows of letter
+             **/
+            void insert( char32_t code, size_type off, size_type wid, size_type count )
+            {
+                if ( code > index_type::max_code )
+                {
+                    return;
+                }
+
+                size_type idx = this->index.find( code );
+
+                if ( idx == index_type::npos )
+                {
+                    idx = this->entries.size();
+                    this->entries.push_back( entry {} );
+                    this->index.insert( code, idx );
+                }
+
+                this->entries[idx] = entry { off, wid, this->left.size() };
+
+                artlib_edges( this->rows.data() + off, wid, count, this->left, this->right );
+            }
+
+            /**
+             * @brief validates rows of all letters
+             * @param height Height of font
+             **/
+            void validate( size_type height ) const
+            {
+                for ( const entry &letter : this->entries )
+                {
+                    artlib_validate_rows( this->rows.data(), this->rows.size(), letter.offset, letter.width, height );
+                }
+            }
+
+            /**
+             * @brief  checks letter is in table
+             * @param  code codepoint of letter
+             * @return true if found
+             **/
+            bool contains( char32_t code ) const noexcept
+            {
+                return this->index.find( code ) != index_type::npos;
+            }
+
+            /**
+             * @brief  used to get anixt_glyph from table
+             * @param  code codepoint of letter
+             * @param  height Height of font
+             * @return anixt_glyph
+             **/
+            anixt_glyph glyph( char32_t code, size_type height ) const
+            {
+                size_type idx = this->index.find( code );
+
+                if ( idx == index_type::npos )
+                {
+                    throw std::runtime_error( "Letter not found in font" );
+                }
+
+                const entry &letter = this->entries[idx];
+
+                return anixt_glyph { this->rows.data() + letter.offset, letter.width, height,
+                                     this->left.data() + letter.edge, this->right.data() + letter.edge, code };
+            }
         };
 
+        /**
+         * @brief swap two basic_anixt_letter_table
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_letter_table<Anixtconfig> &lhs,
+                   basic_anixt_letter_table<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
         /**
          * @class  basic_anixt_json_font
          * @brief  This class reads font for anixt class
@@ -97,18 +358,30 @@ namespace srilakshmikanthanp
             using traits_type  = typename base::anixt_config::traits_type;
             using string_type  = typename base::anixt_config::string_type;
             using shrink_type  = typename base::anixt_config::shrink;
-            using anixt_letter = typename base::anixt_config::anixt_letter;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
             template <typename T>
             using alloc_type = typename base::anixt_config::template alloc_type<T>;
+            template <typename T>
+            using vector_type = typename base::anixt_config::template vector_type<T>;
             using json_type  = nlohmann::basic_json<std::map, std::vector,
                                                    string_type, bool, int64_t,
                                                    size_type, double, alloc_type>;
 
            private:
             /**
-             * @brief stores font file.
+             * @brief stores anixt_config of font
              **/
-            json_type json_font;
+            anixt_config config {};
+
+            /**
+             * @brief stores decoded letters
+             **/
+            basic_anixt_letter_table<Anixtconfig> table;
+
+            /**
+             * @brief true if font is validated
+             **/
+            bool valid { false };
 
             /**
              * @brief converts ascii character of std::string
@@ -119,6 +392,98 @@ namespace srilakshmikanthanp
                 return string_type( str.begin(), str.end() );
             }
 
+            /**
+             * @struct decoder
+             * @brief  receives config and letters of json font
+             *         from artlib_json_sax and fills the table
+             **/
+            struct decoder
+            {
+                basic_anixt_json_font &                                font;
+                artlib_json_rows<string_type, vector_type<size_type>> packer;
+                char32_t                                               code { 0 };
+                bool                                                   used { false };
+                size_type                                              min_rows { string_type::npos };
+                size_type                                              max_rows { 0 };
+                unsigned int                                           seen { 0 };
+
+                explicit decoder( basic_anixt_json_font &font )
+                    : font( font ),
+                      packer( font.table.buffer() )
+                {
+                }
+
+                void config( const string_type &key, long long value )
+                {
+                    // Layout -1 is font without layout, others are
+                    // sizes
+                    if ( value < 0 && key != cvt( "Layout" ) )
+                    {
+                        throw std::runtime_error( "Negative value in config" );
+                    }
+
+                    if ( key == cvt( "HardBlank" ) )
+                    {
+                        this->font.config.HardBlank = static_cast<char_type>( value );
+                        this->seen |= 1;
+                    }
+                    else if ( key == cvt( "Height" ) )
+                    {
+                        this->font.config.Height = static_cast<size_type>( value );
+                        this->seen |= 2;
+                    }
+                    else if ( key == cvt( "Shrink" ) )
+                    {
+                        this->font.config.Shrink = static_cast<shrink_type>( value );
+                        this->seen |= 4;
+                    }
+                    else if ( key == cvt( "Layout" ) )
+                    {
+                        this->font.config.Layout = static_cast<long>( std::clamp<long long>( value, -2, artlib_max_layout + 1 ) );
+                    }
+                }
+
+                void begin( const string_type &name )
+                {
+                    // keys are one codepoint, others can not be
+                    // reached by text
+                    const char_type *it  = name.data();
+                    const char_type *end = it + name.size();
+
+                    this->used = it != end;
+
+                    if ( this->used )
+                    {
+                        this->code = artlib_decode( it, end );
+                        this->used = it == end;
+                    }
+
+                    this->packer.begin();
+                }
+
+                void row( const string_type &str )
+                {
+                    if ( this->used )
+                    {
+                        this->packer.row( str );
+                    }
+                }
+
+                void end()
+                {
+                    if ( !this->used )
+                    {
+                        return;
+                    }
+
+                    size_type width = this->packer.end();
+
+                    this->font.table.insert( this->code, this->packer.offset(), width, this->packer.count() );
+                    this->min_rows = std::min( this->min_rows, this->packer.count() );
+                    this->max_rows = std::max( this->max_rows, this->packer.count() );
+                }
+            };
+
            public:
             basic_anixt_json_font()                                    = default;
             basic_anixt_json_font( const basic_anixt_json_font & )     = default;
@@ -133,22 +498,27 @@ namespace srilakshmikanthanp
              **/
             void clear() noexcept override
             {
-                this->json_font.clear();
+                this->config.clear();
+                this->table.clear();
+                this->valid = false;
             }
 
             /**
              * @brief swap contents
              * @param obj object to swap
              **/
-            void swap( basic_anixt_json_font &obj )
+            void swap( basic_anixt_json_font &obj ) noexcept
             {
                 using std::swap;
-                swap( this->json_font, obj.json_font );
+                swap( this->config, obj.config );
+                swap( this->table, obj.table );
+                swap( this->valid, obj.valid );
             }
 
             /**
              * @brief used to set font file, call this before 
-             *        any other operation.
+             *        any other operation. font is streamed
+             *        straight in to table without json tree.
              * @param fp full path to font file
              **/
             void set_font( const std::filesystem::path &fp ) override
@@ -165,36 +535,74 @@ namespace srilakshmikanthanp
                     throw std::runtime_error( "Unable to open file" );
                 }
 
-                font_file >> this->json_font;
+                this->clear();
+
+                decoder                             dec( *this );
+                artlib_json_sax<json_type, decoder> sax( dec, cvt( "anixt_config" ), cvt( "anixt_letter" ) );
+
+                try
+                {
+                    sax.parse( font_file );
+
+                    if ( dec.seen != 7 )
+                    {
+                        throw std::runtime_error( "anixt_config not found" );
+                    }
+
+                    if ( dec.max_rows != 0 &&
+                         ( dec.min_rows != this->config.Height || dec.max_rows != this->config.Height ) )
+                    {
+                        throw std::runtime_error( "Height is not equal" );
+                    }
+
+                    artlib_validate_config( this->config, shrink_type::level_2 );
+                    artlib_validate_layout( this->config.Layout );
+                    this->table.validate( this->config.Height );
+                    this->valid = true;
+                }
+                catch ( ... )
+                {
+                    this->clear();
+                    throw;
+                }
             }
 
             /**
              * @brief  used to get anixt_config
              * @return anixt_config
              **/
-            anixt_config get_anixt_config() override
+            anixt_config get_anixt_config() const override
             {
-                anixt_config ret;
-
-                ret.HardBlank = this->json_font[cvt( "anixt_config" )][cvt( "HardBlank" )]
-                                    .template get<size_type>();
-                ret.Height    = this->json_font[cvt( "anixt_config" )][cvt( "Height" )]
-                                    .template get<size_type>();
-                ret.Shrink    = this->json_font[cvt( "anixt_config" )][cvt( "Shrink" )]
-                                    .template get<shrink_type>();
+                return this->config;
+            }
 
-                return ret;
+            /**
+             * @brief  tells font is validated at load
+             * @return true if validated
+             **/
+            bool validated() const noexcept override
+            {
+                return this->valid;
             }
 
             /**
-             * @brief used to get anixt_letter from font
+             * @brief used to get anixt_glyph from font
              * @param key key letter
-             * @return anixt_letter
+             * @return anixt_glyph
+             **/
+            anixt_glyph operator()( char_type key ) const override
+            {
+                return this->table.glyph( static_cast<std::make_unsigned_t<char_type>>( key ), this->config.Height );
+            }
+
+            /**
+             * @brief used to get anixt_glyph of codepoint from font
+             * @param code codepoint
+             * @return anixt_glyph
              **/
-            anixt_letter operator()( char_type key )
+            anixt_glyph get_anixt_glyph( char32_t code ) const override
             {
-                return this->json_font[cvt( "anixt_letter" )][string_type( 1, key )]
-                           .template get<anixt_letter>();
+                return this->table.glyph( code, this->config.Height );
             }
         };
 
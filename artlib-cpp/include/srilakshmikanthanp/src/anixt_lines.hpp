@@ -0,0 +1,531 @@
+///@file anixt_lines.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_LINES_HEADER
+#define ANIXT_LINES_HEADER
+
+#include "algorithm"
+#include "anixt_config.hpp"
+#include "anixt_style.hpp"
+#include "cstdint"
+#include "type_traits"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @brief vertical layout of lines of text
+         *
+         * full stacks lines one below other
+         *
+         * fitting moves lines up till their ink touch
+         *
+         * smushing moves lines one more row up where touching
+         * characters smush in to one
+         **/
+        enum class anixt_vertical
+        {
+            full,
+            fitting,
+            smushing
+        };
+
+        /**
+         * @struct anixt_vsmush_rule
+         * @brief  vertical smush rules of FIGlet as bits of rule
+         *         mask, equal to vertical line are bits 8 to 12 of
+         *         full layout. universal is used by layout without
+         *         vertical rules, fonts without layout use all rules
+         **/
+        struct anixt_vsmush_rule
+        {
+            static constexpr unsigned int equal           = 1;
+            static constexpr unsigned int underscore      = 2;
+            static constexpr unsigned int hierarchy       = 4;
+            static constexpr unsigned int horizontal_line = 8;
+            static constexpr unsigned int vertical_line   = 16;
+            static constexpr unsigned int universal       = 32;
+
+            /**
+             * @brief  rule mask of FIGlet full layout
+             * @param  layout full layout, -1 if font has no layout
+             * @return rule mask
+             **/
+            static constexpr unsigned int of( long layout ) noexcept
+            {
+                if ( layout < 0 )
+                {
+                    return equal | underscore | hierarchy | horizontal_line | vertical_line;
+                }
+
+                unsigned int rules = ( static_cast<unsigned int>( layout ) >> 8 ) & 31;
+
+                return rules != 0 ? rules : universal;
+            }
+        };
+
+        /**
+         * @brief  smushes character of upper line with character
+         *         of lower line by rules of mask
+         * @param  top character of upper line
+         * @param  bottom character of lower line
+         * @param  rules rule mask, see @ref anixt_vsmush_rule
+         * @param  out smushed character
+         * @return true if pair smushes
+         **/
+        template <typename CharT>
+        constexpr bool anixt_vsmush( CharT top, CharT bottom, unsigned int rules, CharT &out ) noexcept
+        {
+            using rule = anixt_vsmush_rule;
+
+            auto t = static_cast<std::uint32_t>( static_cast<std::make_unsigned_t<CharT>>( top ) );
+            auto b = static_cast<std::uint32_t>( static_cast<std::make_unsigned_t<CharT>>( bottom ) );
+
+            if ( ( rules & rule::universal ) != 0 )
+            {
+                out = bottom;
+                return true;
+            }
+
+            if ( ( rules & rule::equal ) != 0 && t == b )
+            {
+                out = top;
+                return true;
+            }
+
+            if ( ( rules & rule::underscore ) != 0 )
+            {
+                if ( t == '_' && anixt_rule_class( b ) != 0 )
+                {
+                    out = bottom;
+                    return true;
+                }
+
+                if ( b == '_' && anixt_rule_class( t ) != 0 )
+                {
+                    out = top;
+                    return true;
+                }
+            }
+
+            if ( ( rules & rule::hierarchy ) != 0 )
+            {
+                std::uint32_t c_t = anixt_rule_class( t );
+                std::uint32_t c_b = anixt_rule_class( b );
+
+                if ( c_t != 0 && c_b != 0 && c_t != c_b )
+                {
+                    out = c_t > c_b ? top : bottom;
+                    return true;
+                }
+            }
+
+            if ( ( rules & rule::horizontal_line ) != 0 && ( ( t == '-' && b == '_' ) || ( t == '_' && b == '-' ) ) )
+            {
+                out = CharT( '=' );
+                return true;
+            }
+
+            if ( ( rules & rule::vertical_line ) != 0 && t == '|' && b == '|' )
+            {
+                out = CharT( '|' );
+                return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @class  basic_anixt_lines
+         * @brief  stacks lines of text rendered by style in to one
+         *         canvas, lines are rendered in to canvases kept
+         *         for next render. place of all lines and size
+         *         of canvas are found before canvas is written, so
+         *         it is set once
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_lines
+        {
+           public:
+            using anixt_config   = Anixtconfig;
+            using allocator_type = typename anixt_config::allocator_type;
+
+           private:
+            using char_type    = typename anixt_config::char_type;
+            using size_type    = typename anixt_config::size_type;
+            using traits_type  = typename anixt_config::traits_type;
+            using string_type  = typename anixt_config::string_type;
+            using anixt_canvas = typename anixt_config::anixt_canvas;
+            using anixt_extent = typename anixt_config::anixt_extent;
+            template <typename T>
+            using vector_type = typename anixt_config::template vector_type<T>;
+
+            /**
+             * @brief canvases of lines
+             **/
+            vector_type<anixt_canvas> lines;
+
+            /**
+             * @brief first row of lines in canvas
+             **/
+            vector_type<size_type> offsets;
+
+            /**
+             * @brief last row with ink and its character of each
+             *        column of lines placed so far
+             **/
+            vector_type<size_type> bottom;
+            vector_type<char_type> ink;
+
+            /**
+             * @brief vertical layout and rules of font
+             **/
+            anixt_vertical layout { anixt_vertical::full };
+            unsigned int   rules { anixt_vsmush_rule::of( -1 ) };
+
+            /**
+             * @brief  first or last row with ink in column of line
+             * @param  line canvas of line
+             * @param  c column
+             * @param  first true for first row
+             * @return row, height of line if column has no ink
+             **/
+            static size_type ink_row( const anixt_canvas &line, size_type c, bool first ) noexcept
+            {
+                size_type height = line.height();
+
+                for ( size_type i = 0; i < height; i++ )
+                {
+                    size_type r = first ? i : height - i - 1;
+
+                    if ( line.row_data( r )[c] != char_type( ' ' ) )
+                    {
+                        return r;
+                    }
+                }
+
+                return height;
+            }
+
+            /**
+             * @brief  finds first row of line, line is moved up from
+             *         end of lines placed so far till its ink touch
+             *         their ink and then one more row if touching
+             *         characters smush. line does not go above top
+             *         of line before it and line without ink is not
+             *         moved
+             * @param  line canvas of line
+             * @param  top first row of line before
+             * @param  end end of rows of lines placed so far
+             * @param  smushed set to true if line is smushed
+             * @return first row of line
+             **/
+            size_type place( const anixt_canvas &line, size_type top, size_type end, bool &smushed ) const
+            {
+                size_type fit = top;
+                bool      any = false;
+
+                smushed = false;
+
+                for ( size_type c = 0; c < line.width(); c++ )
+                {
+                    size_type lead = ink_row( line, c, true );
+
+                    if ( lead == line.height() )
+                    {
+                        continue;
+                    }
+
+                    any = true;
+
+                    if ( this->bottom[c] != string_type::npos && this->bottom[c] + 1 > lead )
+                    {
+                        fit = std::max( fit, this->bottom[c] + 1 - lead );
+                    }
+                }
+
+                if ( !any )
+                {
+                    return end;
+                }
+
+                if ( this->layout != anixt_vertical::smushing || fit == top )
+                {
+                    return fit;
+                }
+
+                for ( size_type c = 0; c < line.width(); c++ )
+                {
+                    size_type lead = ink_row( line, c, true );
+                    char_type out  = char_type( ' ' );
+
+                    if ( lead != line.height() && this->bottom[c] != string_type::npos && this->bottom[c] + 1 == fit + lead &&
+                         !anixt_vsmush( this->ink[c], line.row_data( lead )[c], this->rules, out ) )
+                    {
+                        return fit;
+                    }
+                }
+
+                smushed = true;
+
+                return fit - 1;
+            }
+
+            /**
+             * @brief updates last row with ink of columns from line
+             *        placed at row y
+             * @param line canvas of line
+             * @param y first row of line
+             * @param smushed true if line is smushed
+             **/
+            void update( const anixt_canvas &line, size_type y, bool smushed )
+            {
+                for ( size_type c = 0; c < line.width(); c++ )
+                {
+                    size_type last = ink_row( line, c, false );
+
+                    if ( last == line.height() )
+                    {
+                        continue;
+                    }
+
+                    char_type ch = line.row_data( last )[c];
+
+                    if ( smushed && this->bottom[c] == y + last )
+                    {
+                        anixt_vsmush( this->ink[c], ch, this->rules, ch );
+                    }
+
+                    this->bottom[c] = y + last;
+                    this->ink[c]    = ch;
+                }
+            }
+
+            /**
+             * @brief  finds first row of first count lines and size
+             *         of canvas they are stacked in
+             * @param  count number of lines
+             * @return width and height of canvas
+             **/
+            anixt_extent arrange( size_type count )
+            {
+                size_type width = 0, height = 0, top = 0;
+
+                for ( size_type k = 0; k < count; k++ )
+                {
+                    width = std::max( width, this->lines[k].width() );
+                }
+
+                this->offsets.resize( count );
+
+                if ( this->layout != anixt_vertical::full )
+                {
+                    this->bottom.assign( width, string_type::npos );
+                    this->ink.assign( width, char_type( ' ' ) );
+                }
+
+                for ( size_type k = 0; k < count; k++ )
+                {
+                    const anixt_canvas &line    = this->lines[k];
+                    bool                smushed = false;
+                    size_type           y       = this->layout == anixt_vertical::full || k == 0
+                                                      ? height
+                                                      : this->place( line, top, height, smushed );
+
+                    if ( this->layout != anixt_vertical::full )
+                    {
+                        this->update( line, y, smushed );
+                    }
+
+                    this->offsets[k] = y;
+                    top              = y;
+                    height           = std::max( height, y + line.height() );
+                }
+
+                return anixt_extent { width, height };
+            }
+
+           public:
+            basic_anixt_lines()                                = default;
+            basic_anixt_lines( const basic_anixt_lines & )     = default;
+            basic_anixt_lines( basic_anixt_lines && ) noexcept = default;
+            ~basic_anixt_lines()                               = default;
+
+            basic_anixt_lines &operator=( const basic_anixt_lines & ) = default;
+            basic_anixt_lines &operator=( basic_anixt_lines && ) noexcept = default;
+
+            /**
+             * @brief constructor, canvases and scratch of lines are
+             *        allocated by alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_lines( const allocator_type &alloc )
+                : lines( alloc ),
+                  offsets( alloc ),
+                  bottom( alloc ),
+                  ink( alloc )
+            {
+            }
+
+            /**
+             * @brief clears the contents, vertical layout is kept
+             **/
+            void clear() noexcept
+            {
+                this->lines.clear();
+                this->offsets.clear();
+                this->bottom.clear();
+                this->ink.clear();
+                this->rules = anixt_vsmush_rule::of( -1 );
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_lines &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->lines, obj.lines );
+                swap( this->offsets, obj.offsets );
+                swap( this->bottom, obj.bottom );
+                swap( this->ink, obj.ink );
+                swap( this->layout, obj.layout );
+                swap( this->rules, obj.rules );
+            }
+
+            /**
+             * @brief sets vertical smush rules from Layout of font
+             * @param config anixt_config
+             **/
+            void set_config( const anixt_config &config ) noexcept
+            {
+                this->rules = anixt_vsmush_rule::of( config.Layout );
+            }
+
+            /**
+             * @brief sets vertical layout
+             * @param layout anixt_vertical
+             **/
+            void set_vertical( anixt_vertical layout ) noexcept
+            {
+                this->layout = layout;
+            }
+
+            /**
+             * @brief  returns vertical layout
+             * @return anixt_vertical
+             **/
+            anixt_vertical get_vertical() const noexcept
+            {
+                return this->layout;
+            }
+
+            /**
+             * @brief  canvas of line to render in, canvases are
+             *         kept for next render
+             * @param  i index of line
+             * @return canvas of line
+             **/
+            anixt_canvas &line( size_type i )
+            {
+                if ( i >= this->lines.size() )
+                {
+                    this->lines.resize( i + 1 );
+                }
+
+                return this->lines[i];
+            }
+
+            /**
+             * @brief  size of canvas first count lines are stacked
+             *         in, lines are not stacked
+             * @param  count number of lines
+             * @return width and height of canvas
+             **/
+            anixt_extent measure( size_type count )
+            {
+                return this->arrange( count );
+            }
+
+            /**
+             * @brief stacks first count lines in to canvas
+             * @param count number of lines
+             * @param canvas anixt_canvas to stack in
+             **/
+            void stack( size_type count, anixt_canvas &canvas )
+            {
+                anixt_extent extent = this->arrange( count );
+
+                canvas.assign( extent.width, extent.height, extent.width );
+
+                size_type end = 0;
+
+                for ( size_type k = 0; k < count; k++ )
+                {
+                    const anixt_canvas &line = this->lines[k];
+                    size_type           y    = this->offsets[k];
+
+                    for ( size_type r = 0; r < line.height(); r++ )
+                    {
+                        const char_type *src = line.row_data( r );
+                        char_type *      dst = canvas.row_data( y + r );
+
+                        if ( y + r >= end )
+                        {
+                            traits_type::copy( dst, src, line.width() );
+                            continue;
+                        }
+
+                        for ( size_type c = 0; c < line.width(); c++ )
+                        {
+                            if ( src[c] == char_type( ' ' ) )
+                            {
+                                continue;
+                            }
+
+                            if ( dst[c] == char_type( ' ' ) || !anixt_vsmush( dst[c], src[c], this->rules, dst[c] ) )
+                            {
+                                dst[c] = src[c];
+                            }
+                        }
+                    }
+
+                    end = std::max( end, y + line.height() );
+                }
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_lines
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_lines<Anixtconfig> &lhs,
+                   basic_anixt_lines<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -0,0 +1,514 @@
+///@file anixt_mmap_font.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_MMAP_FONT_HEADER
+#define ANIXT_MMAP_FONT_HEADER
+
+#include "algorithm"
+#include "anixt_font.hpp"
+#include "cstddef"
+#include "cstdint"
+#include "cstring"
+#include "filesystem"
+#include "fstream"
+#include "memory"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include "fcntl.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "unistd.h"
+#define ARTLIB_HAS_MMAP
+#endif
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @struct anixt_binary_header
+         * @brief  header of anixt binary font, file is laid
+         *         out as header, index of count entries sorted
+         *         by code, edges and packed rows of all letters.
+         *         edges are left edges of rows of letters in
+         *         order of index and then right edges, each of
+         *         edge_size bytes. version 2 has no edges, it ends
+         *         at edges_offset, version 1 has no layout, it ends
+         *         at layout.
+         **/
+        struct anixt_binary_header
+        {
+            /**
+             * @brief magic of anixt binary font
+             **/
+            static constexpr char magic_value[8] = { 'A', 'N', 'I', 'X', 'T', 'B', 'F', '\0' };
+
+            /**
+             * @brief version of anixt binary font
+             **/
+            static constexpr std::uint32_t version_value = 3;
+
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t char_size;
+            std::uint32_t height;
+            std::uint32_t hardblank;
+            std::uint32_t shrink;
+            std::uint32_t count;
+            std::uint64_t index_offset;
+            std::uint64_t rows_offset;
+            std::int64_t  layout;
+            std::uint64_t edges_offset;
+            std::uint64_t edge_size;
+        };
+
+        /**
+         * @struct anixt_binary_entry
+         * @brief  index entry of anixt binary font, rows of
+         *         letter are height rows of width char units
+         *         at offset(in char units) from rows_offset
+         **/
+        struct anixt_binary_entry
+        {
+            std::uint32_t code;
+            std::uint32_t width;
+            std::uint64_t offset;
+        };
+
+        /**
+         * @brief  maps the file read only, file is read in
+         *         to memory where mmap is not there
+         * @param  fp full path to file
+         * @param  size size of file
+         * @return mapping
+         **/
+        inline std::shared_ptr<const unsigned char> artlib_map_file( const std::filesystem::path &fp, std::size_t &size )
+        {
+#ifdef ARTLIB_HAS_MMAP
+            int         fd = ::open( fp.c_str(), O_RDONLY );
+            struct stat st;
+
+            if ( fd < 0 )
+            {
+                throw std::runtime_error( "Unable to open file" );
+            }
+
+            if ( ::fstat( fd, &st ) != 0 || st.st_size <= 0 )
+            {
+                ::close( fd );
+                throw std::runtime_error( "Invalid font file" );
+            }
+
+            size       = static_cast<std::size_t>( st.st_size );
+            void *addr = ::mmap( nullptr, size, PROT_READ, MAP_SHARED, fd, 0 );
+
+            ::close( fd );
+
+            if ( addr == MAP_FAILED )
+            {
+                throw std::runtime_error( "Unable to map file" );
+            }
+
+            return std::shared_ptr<const unsigned char>(
+                static_cast<const unsigned char *>( addr ),
+                [size]( const unsigned char *p ) {
+                    ::munmap( const_cast<unsigned char *>( p ), size );
+                } );
+#else
+            std::ifstream file { fp, std::ios_base::binary | std::ios_base::ate };
+
+            if ( !file.is_open() )
+            {
+                throw std::runtime_error( "Unable to open file" );
+            }
+
+            size = static_cast<std::size_t>( file.tellg() );
+
+            std::shared_ptr<unsigned char> data( new unsigned char[size], std::default_delete<unsigned char[]>() );
+
+            file.seekg( 0 );
+
+            if ( !file.read( reinterpret_cast<char *>( data.get() ), size ) )
+            {
+                throw std::runtime_error( "Invalid font file" );
+            }
+
+            return data;
+#endif
+        }
+
+        /**
+         * @class  basic_anixt_mmap_font
+         * @brief  This class maps anixt binary font read only
+         *         and reads letters and their edges straight from
+         *         the mapping. rows and edges are validated by
+         *         fontcvt when file is written, load checks header
+         *         and index only. files without edges or with edges
+         *         of other size are validated and their edges are
+         *         found at load
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_mmap_font : public basic_anixt_base_font<Anixtconfig>
+        {
+           protected:
+            using base = basic_anixt_base_font<Anixtconfig>;
+
+           public:
+            using anixt_config = typename base::anixt_config;
+
+           private:
+            using char_type    = typename base::anixt_config::char_type;
+            using size_type    = typename base::anixt_config::size_type;
+            using string_type  = typename base::anixt_config::string_type;
+            using shrink_type  = typename base::anixt_config::shrink;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
+            using byte_type    = unsigned char;
+            template <typename T>
+            using vector_type = typename base::anixt_config::template vector_type<T>;
+
+           private:
+            /**
+             * @brief mapping of font file, shared by copies
+             **/
+            std::shared_ptr<const byte_type> mapping;
+
+            /**
+             * @brief stores anixt_config of font
+             **/
+            anixt_config config {};
+
+            /**
+             * @brief index of letters in mapping
+             **/
+            const anixt_binary_entry *entries { nullptr };
+
+            /**
+             * @brief number of entries in index
+             **/
+            size_type count { 0 };
+
+            /**
+             * @brief rows of letters in mapping
+             **/
+            const char_type *rows { nullptr };
+
+            /**
+             * @brief true if font is validated
+             **/
+            bool valid { false };
+
+            /**
+             * @brief edges of rows of letters, edges of entry i
+             *        start at i * Height. they are in mapping or
+             *        in edges
+             **/
+            const size_type *left { nullptr }, *right { nullptr };
+
+            /**
+             * @brief left and right edges found at load when file
+             *        has no edges
+             **/
+            vector_type<size_type> edges;
+
+            /**
+             * @brief  checks n units of size unit from offset are
+             *         inside file of size bytes
+             * @param  offset offset in bytes
+             * @param  n number of units
+             * @param  unit size of unit in bytes
+             * @param  size size of file
+             * @return true if units are inside file
+             **/
+            static bool inside( std::uint64_t offset, std::uint64_t n, std::uint64_t unit, std::uint64_t size ) noexcept
+            {
+                return offset <= size && n <= ( size - offset ) / unit;
+            }
+
+            /**
+             * @brief  finds entry of codepoint, probes the position
+             *         of code first as index is usually dense
+             * @param  code codepoint
+             * @return entry or nullptr
+             **/
+            const anixt_binary_entry *find( std::uint32_t code ) const noexcept
+            {
+                if ( this->count == 0 )
+                {
+                    return nullptr;
+                }
+
+                std::uint32_t probe = code - this->entries[0].code;
+
+                if ( code >= this->entries[0].code && probe < this->count &&
+                     this->entries[probe].code == code )
+                {
+                    return this->entries + probe;
+                }
+
+                const anixt_binary_entry *last = this->entries + this->count;
+                const anixt_binary_entry *it   = std::lower_bound(
+                    this->entries, last, code,
+                    []( const anixt_binary_entry &e, std::uint32_t c ) { return e.code < c; } );
+
+                return ( it != last && it->code == code ) ? it : nullptr;
+            }
+
+           public:
+            basic_anixt_mmap_font()                                    = default;
+            basic_anixt_mmap_font( const basic_anixt_mmap_font & )     = default;
+            basic_anixt_mmap_font( basic_anixt_mmap_font && ) noexcept = default;
+            ~basic_anixt_mmap_font()                                   = default;
+
+            basic_anixt_mmap_font &operator=( const basic_anixt_mmap_font & ) = default;
+            basic_anixt_mmap_font &operator=( basic_anixt_mmap_font && ) noexcept = default;
+
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept override
+            {
+                this->mapping.reset();
+                this->config.clear();
+                this->entries = nullptr;
+                this->count   = 0;
+                this->rows    = nullptr;
+                this->valid   = false;
+                this->left    = nullptr;
+                this->right   = nullptr;
+                this->edges.clear();
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_mmap_font &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->mapping, obj.mapping );
+                swap( this->config, obj.config );
+                swap( this->entries, obj.entries );
+                swap( this->count, obj.count );
+                swap( this->rows, obj.rows );
+                swap( this->valid, obj.valid );
+                swap( this->left, obj.left );
+                swap( this->right, obj.right );
+                swap( this->edges, obj.edges );
+            }
+
+            /**
+             * @brief used to set font file, call this before
+             *        any other operation.
+             * @param fp full path to binary font file
+             **/
+            void set_font( const std::filesystem::path &fp ) override
+            {
+                std::size_t                      size = 0;
+                std::shared_ptr<const byte_type> data = artlib_map_file( fp, size );
+                anixt_binary_header              header {};
+                std::size_t                      first = offsetof( anixt_binary_header, layout );
+
+                if ( size < first )
+                {
+                    throw std::runtime_error( "Invalid font file" );
+                }
+
+                std::memcpy( &header, data.get(), first );
+
+                if ( std::memcmp( header.magic, anixt_binary_header::magic_value, sizeof( header.magic ) ) != 0 ||
+                     header.version == 0 || header.version > anixt_binary_header::version_value )
+                {
+                    throw std::runtime_error( "Invalid font file" );
+                }
+
+                // older versions end before fields they do not have
+                std::size_t known = header.version == 1   ? first
+                                    : header.version == 2 ? offsetof( anixt_binary_header, edges_offset )
+                                                          : sizeof( header );
+
+                if ( size < known )
+                {
+                    throw std::runtime_error( "Invalid font file" );
+                }
+
+                std::memcpy( &header, data.get(), known );
+
+                if ( header.version == 1 )
+                {
+                    header.layout = -1;
+                }
+
+                if ( header.char_size != sizeof( char_type ) )
+                {
+                    throw std::runtime_error( "Font char size is not equal" );
+                }
+
+                if ( header.index_offset % alignof( anixt_binary_entry ) != 0 ||
+                     header.rows_offset % alignof( char_type ) != 0 ||
+                     !inside( header.index_offset, header.count, sizeof( anixt_binary_entry ), size ) ||
+                     header.rows_offset > size )
+                {
+                    throw std::runtime_error( "Invalid font file" );
+                }
+
+                const auto *  index = reinterpret_cast<const anixt_binary_entry *>( data.get() + header.index_offset );
+                std::uint64_t units = ( size - header.rows_offset ) / sizeof( char_type );
+
+                for ( std::uint32_t i = 0; i < header.count; i++ )
+                {
+                    if ( ( i != 0 && index[i - 1].code >= index[i].code ) ||
+                         index[i].offset > units ||
+                         std::uint64_t( index[i].width ) * header.height > units - index[i].offset )
+                    {
+                        throw std::runtime_error( "Invalid font file" );
+                    }
+                }
+
+                anixt_config checked {};
+                const auto * text = reinterpret_cast<const char_type *>( data.get() + header.rows_offset );
+
+                checked.HardBlank = static_cast<char_type>( header.hardblank );
+                checked.Height    = header.height;
+                checked.Shrink    = static_cast<shrink_type>( header.shrink );
+                checked.Layout    = static_cast<long>( std::clamp<std::int64_t>( header.layout, -2, artlib_max_layout + 1 ) );
+
+                artlib_validate_config( checked, shrink_type::level_2 );
+                artlib_validate_layout( checked.Layout );
+
+                // edges are read as is only if they are of size_type
+                std::uint64_t cells  = std::uint64_t( header.count ) * header.height;
+                bool          mapped = header.version >= 3 && header.edge_size == sizeof( size_type );
+
+                if ( mapped && ( header.edges_offset % alignof( size_type ) != 0 ||
+                                 !inside( header.edges_offset, cells, 2 * sizeof( size_type ), size ) ) )
+                {
+                    throw std::runtime_error( "Invalid font file" );
+                }
+
+                if ( !mapped )
+                {
+                    for ( std::uint32_t i = 0; i < header.count; i++ )
+                    {
+                        artlib_validate_rows( text, std::uint64_t( units ), std::uint64_t( index[i].offset ),
+                                              std::uint64_t( index[i].width ), std::uint64_t( header.height ) );
+                    }
+                }
+
+                this->clear();
+
+                this->config  = checked;
+                this->valid   = true;
+                this->entries = index;
+                this->count   = header.count;
+                this->rows    = text;
+
+                if ( mapped )
+                {
+                    this->left  = reinterpret_cast<const size_type *>( data.get() + header.edges_offset );
+                    this->right = this->left + cells;
+                }
+                else
+                {
+                    vector_type<size_type> right;
+
+                    this->edges.reserve( 2 * std::size_t( cells ) );
+                    right.reserve( std::size_t( cells ) );
+
+                    for ( std::uint32_t i = 0; i < header.count; i++ )
+                    {
+                        artlib_edges( this->rows + index[i].offset, size_type( index[i].width ),
+                                      size_type( header.height ), this->edges, right );
+                    }
+
+                    this->edges.insert( this->edges.end(), right.begin(), right.end() );
+
+                    this->left  = this->edges.data();
+                    this->right = this->left + cells;
+                }
+
+                this->mapping = std::move( data );
+            }
+
+            /**
+             * @brief  used to get anixt_config
+             * @return anixt_config
+             **/
+            anixt_config get_anixt_config() const override
+            {
+                return this->config;
+            }
+
+            /**
+             * @brief  tells font is validated at load
+             * @return true if validated
+             **/
+            bool validated() const noexcept override
+            {
+                return this->valid;
+            }
+
+            /**
+             * @brief used to get anixt_glyph from font, glyph
+             *        refers the mapping
+             * @param key key letter
+             * @return anixt_glyph
+             **/
+            anixt_glyph operator()( char_type key ) const override
+            {
+                return this->get_anixt_glyph( static_cast<std::make_unsigned_t<char_type>>( key ) );
+            }
+
+            /**
+             * @brief used to get anixt_glyph of codepoint from font,
+             *        glyph refers the mapping
+             * @param code codepoint
+             * @return anixt_glyph
+             **/
+            anixt_glyph get_anixt_glyph( char32_t code ) const override
+            {
+                const anixt_binary_entry *entry = this->find( code );
+
+                if ( entry == nullptr )
+                {
+                    throw std::runtime_error( "Letter not found in font" );
+                }
+
+                size_type edge = ( entry - this->entries ) * this->config.Height;
+
+                return anixt_glyph { this->rows + entry->offset, entry->width, this->config.Height,
+                                     this->left + edge, this->right + edge, code };
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_mmap_font
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_mmap_font<Anixtconfig> &lhs,
+                   basic_anixt_mmap_font<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -0,0 +1,940 @@
+///@file anixt_renderer.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ * 
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_RENDERER_HEADER
+#define ANIXT_RENDERER_HEADER
+
+#include "algorithm"
+#include "anixt_batch.hpp"
+#include "anixt_config.hpp"
+#include "anixt_font.hpp"
+#include "anixt_lines.hpp"
+#include "array"
+#include "artlib_registry.hpp"
+#include "artlib_sink.hpp"
+#include "artlib_unicode.hpp"
+#include "filesystem"
+#include "iterator"
+#include "memory"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  basic_anixt_renderer
+         * @brief  renders text by font and style without stream, it
+         *         is what basic_anixt renders its buffer with. const
+         *         methods reuse buffers of renderer so it is not
+         *         thread safe, threads should have own renderer that
+         *         share font
+         * @tparam StyleT style_type
+         * @tparam FontT font_type
+         * @tparam Anixtconfig anixt_config
+         **/
+        template <typename StyleT, typename FontT, typename Anixtconfig>
+        class basic_anixt_renderer
+        {
+           public:
+            using style_type     = StyleT;
+            using font_type      = FontT;
+            using anixt_config   = Anixtconfig;
+            using vertical_type  = anixt_vertical;
+            using allocator_type = typename anixt_config::allocator_type;
+            using batch_type     = basic_anixt_batch<Anixtconfig>;
+
+           private:
+            using char_type        = typename anixt_config::char_type;
+            using size_type        = typename anixt_config::size_type;
+            using traits_type      = typename anixt_config::traits_type;
+            using string_type      = typename anixt_config::string_type;
+            using string_view_type = typename anixt_config::string_view_type;
+            using anixt_glyph      = typename anixt_config::anixt_glyph;
+            using anixt_string     = typename anixt_config::anixt_string;
+            using anixt_canvas     = typename anixt_config::anixt_canvas;
+            using anixt_extent     = typename anixt_config::anixt_extent;
+            template <typename T>
+            using vector_type = typename anixt_config::template vector_type<T>;
+            using lines_type  = basic_anixt_lines<anixt_config>;
+
+           private:
+            anixt_config                     config;
+            std::shared_ptr<const font_type> font;
+            mutable style_type               style;
+            mutable lines_type               lines;
+            mutable vector_type<anixt_glyph> glyphs;
+            mutable anixt_canvas             scratch;
+            mutable vector_type<string_type> spare;
+            mutable vector_type<size_type>   ends;
+            size_type                        wrap { 0 };
+
+            /**
+             * @brief number of spaces written by one segment
+             **/
+            static constexpr size_type blank_size = 64;
+
+            /**
+             * @brief  collects glyphs of [first, last) and passes
+             *         them to fn, glyphs are valid till fn returns.
+             *         vector of glyphs is kept for next render
+             * @param  first begin of text
+             * @param  last end of text
+             * @param  fn called with vector of anixt_glyph
+             * @return result of fn
+             **/
+            template <typename Fn>
+            auto collect( const char_type *first, const char_type *last, Fn fn ) const
+            {
+                vector_type<anixt_glyph> &anixtglyphs = this->glyphs;
+
+                if ( !this->font )
+                {
+                    throw std::runtime_error( "Font is not set" );
+                }
+
+                anixtglyphs.clear();
+                anixtglyphs.reserve( static_cast<size_type>( last - first ) );
+
+                // glyphs of caching fonts stay valid till unpin
+                artlib_pin_guard<font_type> pin( *this->font );
+
+                for ( const char_type *it = first; it != last; )
+                {
+                    anixtglyphs.push_back( this->font->get_anixt_glyph( artlib_decode( it, last ) ) );
+                }
+
+                // glyphs of validated font are known to be Height
+                // rows, styles compose without check
+                if ( !this->font->validated() )
+                {
+                    for ( const auto &al : anixtglyphs )
+                    {
+                        if ( al.size() != this->config.Height )
+                        {
+                            throw std::runtime_error( "Height is not equal" );
+                        }
+                    }
+                }
+
+                return fn( anixtglyphs );
+            }
+
+            /**
+             * @brief  calls fn with begin, end and index of each line
+             *         of [first, last), newline of line is not passed
+             * @param  first begin of text
+             * @param  last end of text
+             * @param  fn called with line
+             * @return number of lines
+             **/
+            template <typename Fn>
+            static size_type each_line( const char_type *first, const char_type *last, Fn fn )
+            {
+                size_type count = 0;
+
+                for ( ;; )
+                {
+                    const char_type *eol = traits_type::find( first, static_cast<size_type>( last - first ), char_type( '\n' ) );
+
+                    fn( first, line_end( first, eol != nullptr ? eol : last ), count++ );
+
+                    if ( eol == nullptr )
+                    {
+                        return count;
+                    }
+
+                    first = eol + 1;
+                }
+            }
+
+            /**
+             * @brief  breaks line [first, last) in to lines not wider
+             *         than wrap, width is measured by style as glyphs
+             *         are appended. when it is more than wrap line
+             *         breaks at last spaces that are dropped and only
+             *         text after them is measured again, word wider
+             *         than wrap breaks before glyph that does not fit
+             *         and glyph wider than wrap is left on its own
+             *         line. spaces at begin of broken line are dropped
+             * @param  first begin of line
+             * @param  last end of line
+             * @param  count index of first line
+             * @param  emit called with vector of anixt_glyph and
+             *         index of each line, glyphs are valid till it
+             *         returns
+             * @return index after last line
+             **/
+            template <typename Emit>
+            size_type wrap_line( const char_type *first, const char_type *last, size_type count, Emit &emit ) const
+            {
+                vector_type<anixt_glyph> &anixtglyphs = this->glyphs;
+                const char_type *         word        = nullptr;
+                size_type                 run         = string_type::npos;
+                bool                      blanks      = false;
+                bool                      broken      = false;
+
+                if ( !this->font )
+                {
+                    throw std::runtime_error( "Font is not set" );
+                }
+
+                anixtglyphs.clear();
+
+                // glyphs of caching fonts stay valid till unpin
+                artlib_pin_guard<font_type> pin( *this->font );
+
+                for ( const char_type *it = first; it != last; )
+                {
+                    const char_type *at    = it;
+                    char32_t         code  = artlib_decode( it, last );
+                    bool             blank = code == char32_t( ' ' );
+
+                    if ( blank && broken && anixtglyphs.empty() )
+                    {
+                        continue;
+                    }
+
+                    anixtglyphs.push_back( this->font->get_anixt_glyph( code ) );
+
+                    if ( !this->font->validated() && anixtglyphs.back().size() != this->config.Height )
+                    {
+                        throw std::runtime_error( "Height is not equal" );
+                    }
+
+                    // run is index of first of last spaces, npos till
+                    // line has spaces
+                    if ( blank && !blanks )
+                    {
+                        run = anixtglyphs.size() - 1;
+                    }
+
+                    if ( this->style.measure_append( anixtglyphs ) <= this->wrap || anixtglyphs.size() == 1 )
+                    {
+                        word   = blank ? it : word;
+                        blanks = blank;
+                        continue;
+                    }
+
+                    // space that does not fit ends line, else line
+                    // ends at last spaces or before glyph
+                    if ( blank )
+                    {
+                        anixtglyphs.resize( run );
+                    }
+                    else if ( word != nullptr && run != string_type::npos )
+                    {
+                        anixtglyphs.resize( run );
+                        it = word;
+                    }
+                    else
+                    {
+                        anixtglyphs.pop_back();
+                        it = at;
+                    }
+
+                    emit( anixtglyphs, count++ );
+
+                    anixtglyphs.clear();
+                    word   = nullptr;
+                    run    = string_type::npos;
+                    blanks = false;
+                    broken = true;
+                }
+
+                if ( !broken || !anixtglyphs.empty() )
+                {
+                    emit( anixtglyphs, count++ );
+                }
+
+                return count;
+            }
+
+            /**
+             * @brief  calls emit with glyphs and index of each line of
+             *         [first, last), lines are wrapped if wrap is set.
+             *         one newline at end of text does not start a line
+             * @param  first begin of text
+             * @param  last end of text
+             * @param  emit called with vector of anixt_glyph and
+             *         index of each line, glyphs are valid till it
+             *         returns
+             * @return number of lines
+             **/
+            template <typename Emit>
+            size_type layout( const char_type *first, const char_type *last, Emit emit ) const
+            {
+                if ( this->wrap == 0 )
+                {
+                    return each_line( first, line_end( first, last ), [this, &emit]( const char_type *it, const char_type *end, size_type k ) {
+                        this->collect( it, end, [&emit, k]( const vector_type<anixt_glyph> &anixtglyphs ) {
+                            emit( anixtglyphs, k );
+                        } );
+                    } );
+                }
+
+                size_type count = 0;
+
+                each_line( first, line_end( first, last ), [this, &emit, &count]( const char_type *it, const char_type *end, size_type ) {
+                    count = this->wrap_line( it, end, count, emit );
+                } );
+
+                return count;
+            }
+
+            /**
+             * @brief  renders lines of [first, last) by style in to
+             *         canvases of lines, each line is rendered once
+             * @param  first begin of text
+             * @param  last end of text
+             * @return number of lines
+             **/
+            size_type render_lines( const char_type *first, const char_type *last ) const
+            {
+                return this->layout( first, last, [this]( const vector_type<anixt_glyph> &anixtglyphs, size_type k ) {
+                    this->style( anixtglyphs, this->lines.line( k ) );
+                } );
+            }
+
+            /**
+             * @brief  checks text is stacked from lines
+             * @param  text text
+             * @return true if text has more than one line or wrap
+             *         is set
+             **/
+            bool stacked( string_view_type text ) const noexcept
+            {
+                return this->wrap != 0 || multiline( text );
+            }
+
+            /**
+             * @brief  end of line without its newline
+             * @param  first begin of line
+             * @param  last end of line
+             * @return end of text of line
+             **/
+            static const char_type *line_end( const char_type *first, const char_type *last ) noexcept
+            {
+                if ( last != first && last[-1] == char_type( '\n' ) )
+                {
+                    --last;
+                }
+
+                if ( last != first && last[-1] == char_type( '\r' ) )
+                {
+                    --last;
+                }
+
+                return last;
+            }
+
+            /**
+             * @brief  checks text has more than one line
+             * @param  text text
+             * @return true if text has newline before its end
+             **/
+            static bool multiline( string_view_type text ) noexcept
+            {
+                size_type pos = text.find( char_type( '\n' ) );
+
+                return pos != string_view_type::npos && pos + 1 != text.size();
+            }
+
+            /**
+             * @brief  row of spaces that blanks of rows are written
+             *         from
+             * @return begin of blank_size spaces
+             **/
+            static const char_type *blank() noexcept
+            {
+                static const std::array<char_type, blank_size> spaces = [] {
+                    std::array<char_type, blank_size> ret;
+                    ret.fill( char_type( ' ' ) );
+                    return ret;
+                }();
+
+                return spaces.data();
+            }
+
+            /**
+             * @brief  newline written after rows
+             * @return pointer to newline
+             **/
+            static const char_type *newline() noexcept
+            {
+                static const char_type ret = char_type( '\n' );
+
+                return &ret;
+            }
+
+            /**
+             * @brief writes count spaces to sink
+             * @param count number of spaces
+             * @param sink sink to write to
+             **/
+            template <typename Sink>
+            static void write_blank( size_type count, Sink &sink )
+            {
+                for ( ; count > blank_size; count -= blank_size )
+                {
+                    sink.append( blank(), blank_size );
+                }
+
+                if ( count != 0 )
+                {
+                    sink.append( blank(), count );
+                }
+            }
+
+            /**
+             * @brief writes [first, last) of row of glyph to sink
+             *        with Hardblank written as space
+             * @param first begin of ink
+             * @param last end of ink
+             * @param sink sink to write to
+             **/
+            template <typename Sink>
+            void write_ink( const char_type *first, const char_type *last, Sink &sink ) const
+            {
+                while ( first != last )
+                {
+                    const char_type *hard = traits_type::find( first, static_cast<size_type>( last - first ), this->config.HardBlank );
+                    const char_type *stop = hard != nullptr ? hard : last;
+
+                    if ( stop != first )
+                    {
+                        sink.append( first, static_cast<size_type>( stop - first ) );
+                    }
+
+                    for ( first = stop; first != last && *first == this->config.HardBlank; )
+                    {
+                        ++first;
+                    }
+
+                    write_blank( static_cast<size_type>( first - stop ), sink );
+                }
+            }
+
+            /**
+             * @brief writes rows of canvas to sink, each row padded
+             *        with spaces to width and ended by newline
+             * @param canvas anixt_canvas to write
+             * @param width width of rows
+             * @param sink sink to write to
+             **/
+            template <typename Sink>
+            static void write_canvas( const anixt_canvas &canvas, size_type width, Sink &sink )
+            {
+                for ( size_type i = 0; i < canvas.height(); i++ )
+                {
+                    sink.append( canvas.row_data( i ), canvas.width() );
+                    write_blank( width - std::min( width, canvas.width() ), sink );
+                    sink.append( newline(), 1 );
+                }
+            }
+
+            /**
+             * @brief writes rows of line of anixtglyphs to sink and
+             *        flushes it, rows are written as segments of
+             *        glyph rows and spaces between them when style
+             *        places glyphs, else line is rendered in to
+             *        canvas kept for next write
+             * @param anixtglyphs vector of anixt_glyph of line
+             * @param width width rows are padded to
+             * @param sink sink to write to
+             **/
+            template <typename Sink>
+            void write_line( const vector_type<anixt_glyph> &anixtglyphs, size_type width, Sink &sink ) const
+            {
+                if ( !this->style.place( anixtglyphs, this->ends ) )
+                {
+                    this->style( anixtglyphs, this->scratch );
+                    write_canvas( this->scratch, width, sink );
+                    sink.flush();
+                    return;
+                }
+
+                size_type len = this->ends.empty() ? 0 : this->ends.back();
+
+                for ( size_type i = 0; i < this->config.Height; i++ )
+                {
+                    size_type col = 0;
+
+                    for ( size_type k = 0; k < anixtglyphs.size(); k++ )
+                    {
+                        const anixt_glyph &al = anixtglyphs[k];
+
+                        if ( al.left[i] == al.width )
+                        {
+                            continue;
+                        }
+
+                        const char_type *row  = al.rows + i * al.width;
+                        size_type        from = this->ends[k] + al.left[i] - al.width;
+                        size_type        to   = this->ends[k] - al.right[i];
+
+                        write_blank( from - col, sink );
+                        this->write_ink( row + al.left[i], row + al.width - al.right[i], sink );
+
+                        col = to;
+                    }
+
+                    write_blank( std::max( width, len ) - col, sink );
+                    sink.append( newline(), 1 );
+                }
+
+                sink.flush();
+            }
+
+            /**
+             * @brief writes glyph rows of line of anixtglyphs placed
+             *        by style in to rows at out that are spaces, glyph
+             *        rows are copied at their columns with Hardblank
+             *        written as space
+             * @param anixtglyphs vector of anixt_glyph of line
+             * @param out begin of first row
+             * @param stride distance between rows
+             **/
+            void place_line( const vector_type<anixt_glyph> &anixtglyphs, char_type *out, size_type stride ) const
+            {
+                char_type hb = this->config.HardBlank;
+
+                for ( size_type k = 0; k < anixtglyphs.size(); k++ )
+                {
+                    const anixt_glyph &al = anixtglyphs[k];
+
+                    for ( size_type i = 0; i < this->config.Height; i++ )
+                    {
+                        if ( al.left[i] == al.width )
+                        {
+                            continue;
+                        }
+
+                        const char_type *row = al.rows + i * al.width;
+
+                        std::replace_copy( row + al.left[i], row + al.width - al.right[i],
+                                           out + i * stride + this->ends[k] + al.left[i] - al.width, hb, char_type( ' ' ) );
+                    }
+                }
+            }
+
+            /**
+             * @brief  extent of anixt string of text that batch is
+             *         reserved for, it is exact for stacked text and
+             *         line placed by style. width of line that style
+             *         smushes is sum of widths of its glyphs, that is
+             *         found without smushing and is not less than it
+             * @param  text text
+             * @return width and height
+             **/
+            anixt_extent bound( string_view_type text ) const
+            {
+                const char_type *first = text.data();
+                const char_type *last  = first + text.size();
+
+                if ( this->stacked( text ) )
+                {
+                    return this->measure( text );
+                }
+
+                return this->collect( first, line_end( first, last ), [this]( const vector_type<anixt_glyph> &anixtglyphs ) {
+                    size_type width = 0;
+
+                    if ( this->style.place( anixtglyphs, this->ends ) )
+                    {
+                        width = this->ends.empty() ? 0 : this->ends.back();
+                    }
+                    else
+                    {
+                        for ( const auto &al : anixtglyphs )
+                        {
+                            width += al.width;
+                        }
+                    }
+
+                    return anixt_extent { width, this->config.Height };
+                } );
+            }
+
+           public:
+            basic_anixt_renderer()                                   = default;
+            basic_anixt_renderer( const basic_anixt_renderer & )     = default;
+            basic_anixt_renderer( basic_anixt_renderer && ) noexcept = default;
+            ~basic_anixt_renderer()                                  = default;
+
+            basic_anixt_renderer &operator=( const basic_anixt_renderer & ) = default;
+            basic_anixt_renderer &operator=( basic_anixt_renderer && ) noexcept = default;
+
+            /**
+             * @brief constructor
+             * @param fp full path to font file
+             **/
+            explicit basic_anixt_renderer( const std::filesystem::path &fp )
+            {
+                this->set_font( fp );
+            }
+
+            /**
+             * @brief constructor, scratch of renderer and style and
+             *        anixt string returned by render are allocated
+             *        by alloc. font is shared so it is not
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_renderer( const allocator_type &alloc )
+                : style( alloc ),
+                  lines( alloc ),
+                  glyphs( alloc ),
+                  scratch( alloc ),
+                  spare( alloc ),
+                  ends( alloc )
+            {
+            }
+
+            /**
+             * @brief  allocator of renderer
+             * @return allocator
+             **/
+            allocator_type get_allocator() const noexcept
+            {
+                return allocator_type( this->spare.get_allocator() );
+            }
+
+            /**
+             * @brief clears the contents, vertical and wrap are kept
+             **/
+            void clear() noexcept
+            {
+                this->config.clear();
+                this->font.reset();
+                this->style.clear();
+                this->lines.clear();
+                this->glyphs.clear();
+                this->scratch.clear();
+                this->spare.clear();
+                this->ends.clear();
+            }
+
+            /**
+             * @brief swap two basic_anixt_renderer
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_renderer &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->config, obj.config );
+                swap( this->font, obj.font );
+                swap( this->style, obj.style );
+                swap( this->lines, obj.lines );
+                swap( this->glyphs, obj.glyphs );
+                swap( this->scratch, obj.scratch );
+                swap( this->spare, obj.spare );
+                swap( this->ends, obj.ends );
+                swap( this->wrap, obj.wrap );
+            }
+
+            /**
+             * @brief used to set font file, font is loaded once
+             *        and shared by all instance using same file
+             * @param fp full path to font file
+             **/
+            void set_font( const std::filesystem::path &fp )
+            {
+                this->set_font( artlib_registry<font_type>::instance().acquire(
+                    fp, []( font_type &font, const std::filesystem::path &path ) {
+                        font.set_font( path );
+                    } ) );
+            }
+
+            /**
+             * @brief used to set loaded font
+             * @param font font shared with others
+             **/
+            void set_font( std::shared_ptr<const font_type> font )
+            {
+                this->clear();
+                this->font   = std::move( font );
+                this->config = this->font->get_anixt_config();
+                this->style.set_config( this->config );
+                this->lines.set_config( this->config );
+
+                if ( !( style_type::shrink_level <= this->config.Shrink ) )
+                {
+                    throw std::runtime_error( "Style is not supported" );
+                }
+            }
+
+            /**
+             * @brief  returns font in use
+             * @return shared font
+             **/
+            std::shared_ptr<const font_type> get_font() const
+            {
+                return this->font;
+            }
+
+            /**
+             * @brief sets how lines of text are stacked, it is
+             *        kept when font is set
+             * @param vertical vertical_type
+             **/
+            void set_vertical( vertical_type vertical ) noexcept
+            {
+                this->lines.set_vertical( vertical );
+            }
+
+            /**
+             * @brief  returns how lines of text are stacked
+             * @return vertical_type
+             **/
+            vertical_type get_vertical() const noexcept
+            {
+                return this->lines.get_vertical();
+            }
+
+            /**
+             * @brief sets width in columns that lines of anixt string
+             *        are wrapped to at spaces, 0 does not wrap. it
+             *        is kept when font is set
+             * @param columns width to wrap to
+             **/
+            void set_wrap( size_type columns ) noexcept
+            {
+                this->wrap = columns;
+            }
+
+            /**
+             * @brief  returns width that lines are wrapped to
+             * @return columns, 0 if lines are not wrapped
+             **/
+            size_type get_wrap() const noexcept
+            {
+                return this->wrap;
+            }
+
+            /**
+             * @brief return configuration
+             * @return anixt_config
+             **/
+            anixt_config get_anixt_config() const
+            {
+                return this->config;
+            }
+
+            /**
+             * @brief renders anixt string of text in to canvas,
+             *        buffers of canvas and of anixt are reused so
+             *        rendering in a loop does not allocate once they
+             *        are large enough
+             * @param text text to render
+             * @param canvas anixt_canvas to render in
+             **/
+            void render_into( string_view_type text, anixt_canvas &canvas ) const
+            {
+                const char_type *first = text.data();
+                const char_type *last  = first + text.size();
+
+                if ( this->stacked( text ) )
+                {
+                    this->lines.stack( this->render_lines( first, last ), canvas );
+                    return;
+                }
+
+                this->collect( first, line_end( first, last ), [this, &canvas]( const vector_type<anixt_glyph> &anixtglyphs ) {
+                    this->style( anixtglyphs, canvas );
+                } );
+            }
+
+            /**
+             * @brief renders anixt string of text in to out, rows of
+             *        out and their buffers are reused
+             * @param text text to render
+             * @param out anixt_string to render in
+             **/
+            void render_into( string_view_type text, anixt_string &out ) const
+            {
+                this->render_into( text, this->scratch );
+                this->scratch.to( out, this->spare );
+            }
+
+            /**
+             * @brief  renders anixt string of text
+             * @param  text text to render
+             * @return anixt_string
+             **/
+            anixt_string render( string_view_type text ) const
+            {
+                anixt_string ret( this->get_allocator() );
+
+                this->render_into( text, ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief  width and height of anixt string of text without
+             *         building it, widths of lines are found from
+             *         glyphs by style. lines stacked by fitting or
+             *         smushing are rendered in to canvases kept for
+             *         next render, their height depends on ink of rows
+             * @param  text text to measure
+             * @return width and height
+             **/
+            anixt_extent measure( string_view_type text ) const
+            {
+                const char_type *first = text.data();
+                const char_type *last  = first + text.size();
+
+                if ( this->lines.get_vertical() != anixt_vertical::full && this->stacked( text ) )
+                {
+                    return this->lines.measure( this->render_lines( first, last ) );
+                }
+
+                size_type width = 0;
+                size_type count = this->layout( first, last, [this, &width]( const vector_type<anixt_glyph> &anixtglyphs, size_type ) {
+                    width = std::max( width, static_cast<size_type>( this->style.measure( anixtglyphs ) ) );
+                } );
+
+                return anixt_extent { width, count * this->config.Height };
+            }
+
+            /**
+             * @brief writes rows of anixt string of text to sink, each
+             *        row ended by newline. rows of untouched and fitted
+             *        lines are written as segments of glyph rows and
+             *        spaces, so anixt string is not built. lines of
+             *        styles that smush are rendered one by one in to
+             *        canvas kept for next write, text stacked by
+             *        fitting or smushing is rendered whole. sink has
+             *        append(data, count) that takes segment valid till
+             *        its flush() returns, flush is called after each
+             *        line, see artlib_sink
+             * @param text text to write
+             * @param sink sink to write to
+             **/
+            template <typename Sink>
+            void write_to( string_view_type text, Sink &sink ) const
+            {
+                const char_type *first = text.data();
+                const char_type *last  = first + text.size();
+
+                if ( this->lines.get_vertical() != anixt_vertical::full && this->stacked( text ) )
+                {
+                    this->render_into( text, this->scratch );
+                    write_canvas( this->scratch, 0, sink );
+                    sink.flush();
+                    return;
+                }
+
+                // lines are padded to widest line, it is measured
+                // from glyphs before lines are written
+                size_type width = this->stacked( text ) ? this->measure( text ).width : 0;
+
+                this->layout( first, last, [this, width, &sink]( const vector_type<anixt_glyph> &anixtglyphs, size_type ) {
+                    this->write_line( anixtglyphs, width, sink );
+                } );
+            }
+
+            /**
+             * @brief renders texts of [first, last) in to batch one
+             *        after other, batch is cleared first. batch is
+             *        reserved once for bound of all texts, then glyph
+             *        rows of lines placed by style are written
+             *        straight in to slot of text. smushed lines and
+             *        stacked texts are rendered in to canvas kept by
+             *        renderer and their rows are copied in to batch.
+             *        texts are read twice so It should be forward
+             *        iterator
+             * @param first begin of texts
+             * @param last end of texts
+             * @param batch basic_anixt_batch to render in
+             **/
+            template <typename It>
+            void render_batch( It first, It last, batch_type &batch ) const
+            {
+                size_type chars = 0;
+                size_type count = 0;
+
+                for ( It it = first; it != last; ++it, ++count )
+                {
+                    anixt_extent extent = this->bound( string_view_type( *it ) );
+
+                    chars += extent.height * ( extent.width + 1 );
+                }
+
+                batch.clear();
+                batch.reserve( chars, count );
+
+                for ( ; first != last; ++first )
+                {
+                    string_view_type text = *first;
+                    const char_type *from = text.data();
+                    const char_type *to   = from + text.size();
+
+                    if ( this->stacked( text ) )
+                    {
+                        this->render_into( text, this->scratch );
+                        batch.push_back( this->scratch );
+                        continue;
+                    }
+
+                    this->collect( from, line_end( from, to ), [this, &batch]( const vector_type<anixt_glyph> &anixtglyphs ) {
+                        if ( !this->style.place( anixtglyphs, this->ends ) )
+                        {
+                            this->style( anixtglyphs, this->scratch );
+                            batch.push_back( this->scratch );
+                            return;
+                        }
+
+                        size_type width = this->ends.empty() ? 0 : this->ends.back();
+
+                        batch.push_back( anixt_extent { width, this->config.Height } );
+                        this->place_line( anixtglyphs, batch.slot( batch.size() - 1 ), width + 1 );
+                    } );
+                }
+            }
+
+            /**
+             * @brief renders texts in to batch, see render_batch
+             * @param texts range of texts
+             * @param batch basic_anixt_batch to render in
+             **/
+            template <typename Range>
+            void render_batch( const Range &texts, batch_type &batch ) const
+            {
+                using std::begin;
+                using std::end;
+
+                this->render_batch( begin( texts ), end( texts ), batch );
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_renderer
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename StyleT, typename FontT, typename Anixtconfig>
+        void swap( basic_anixt_renderer<StyleT, FontT, Anixtconfig> &lhs,
+                   basic_anixt_renderer<StyleT, FontT, Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
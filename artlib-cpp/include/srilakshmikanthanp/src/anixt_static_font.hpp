@@ -0,0 +1,279 @@
+///@file anixt_static_font.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_STATIC_FONT_HEADER
+#define ANIXT_STATIC_FONT_HEADER
+
+#include "anixt_font.hpp"
+#include "cstddef"
+#include "iterator"
+#include "memory"
+#include "type_traits"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @struct anixt_static_entry
+         * @brief  entry of letter in static font, rows of letter
+         *         are height rows of width at offset in rows and
+         *         their edges are height entries at edge in left
+         *         and right
+         **/
+        struct anixt_static_entry
+        {
+            std::size_t offset;
+            std::size_t width;
+            std::size_t edge;
+            bool        found;
+        };
+
+        /**
+         * @struct anixt_static_layout
+         * @brief  layout of font data, -1 for data generated
+         *         before fonts had layout
+         * @tparam Data generated font data
+         **/
+        template <typename Data, typename = void>
+        struct anixt_static_layout
+        {
+            static constexpr long value = -1;
+        };
+
+        template <typename Data>
+        struct anixt_static_layout<Data, std::void_t<decltype( Data::layout )>>
+        {
+            static constexpr long value = Data::layout;
+        };
+
+        /**
+         * @brief  checks letters of font data as fonts from file
+         *         are checked at load, rows of letter should be
+         *         height rows of width inside rows[] without line
+         *         break and its edges should be inside left[] and
+         *         right[] and not more than width
+         * @tparam Data generated font data
+         * @return true if letters are valid
+         **/
+        template <typename Data>
+        constexpr bool anixt_static_letters_valid() noexcept
+        {
+            for ( const anixt_static_entry &entry : Data::letters )
+            {
+                if ( !entry.found )
+                {
+                    continue;
+                }
+
+                std::size_t count = std::size( Data::rows );
+
+                if ( entry.offset > count || ( entry.width != 0 && Data::height > ( count - entry.offset ) / entry.width ) )
+                {
+                    return false;
+                }
+
+                for ( std::size_t c = entry.offset; c != entry.offset + entry.width * Data::height; c++ )
+                {
+                    if ( Data::rows[c] == '\n' || Data::rows[c] == '\r' )
+                    {
+                        return false;
+                    }
+                }
+
+                if ( entry.edge > std::size( Data::left ) || Data::height > std::size( Data::left ) - entry.edge ||
+                     entry.edge > std::size( Data::right ) || Data::height > std::size( Data::right ) - entry.edge )
+                {
+                    return false;
+                }
+
+                for ( std::size_t i = entry.edge; i != entry.edge + Data::height; i++ )
+                {
+                    if ( Data::left[i] > entry.width || Data::right[i] > entry.width )
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @class  basic_anixt_static_font
+         * @brief  This class reads font for anixt class from
+         *         constexpr tables compiled in to program, tables
+         *         are generated by fontcvt as header.
+         *
+         *         Data should have
+         *         hardblank, height, shrink, rows[], left[], right[],
+         *         letters[] where letters[] is indexed by code unit,
+         *         layout is optional
+         * @tparam Anixtconfig type of anixt_config
+         * @tparam Data generated font data
+         **/
+        template <typename Anixtconfig, typename Data>
+        class basic_anixt_static_font : public basic_anixt_base_font<Anixtconfig>
+        {
+           protected:
+            using base = basic_anixt_base_font<Anixtconfig>;
+
+           public:
+            using anixt_config = typename base::anixt_config;
+            using data_type    = Data;
+
+           private:
+            using char_type    = typename base::anixt_config::char_type;
+            using size_type    = typename base::anixt_config::size_type;
+            using string_type  = typename base::anixt_config::string_type;
+            using shrink_type  = typename base::anixt_config::shrink;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
+
+            static_assert( std::is_same_v<std::remove_cv_t<std::remove_extent_t<decltype( Data::rows )>>, char_type>,
+                           "Font data is not of char_type" );
+            static_assert( std::is_same_v<std::remove_cv_t<std::remove_extent_t<decltype( Data::left )>>, size_type>,
+                           "Font data is not of size_type" );
+            static_assert( Data::height != 0, "Height is not valid" );
+            static_assert( Data::hardblank != ' ' && Data::hardblank != '\n' && Data::hardblank != '\r',
+                           "HardBlank is not valid" );
+            static_assert( Data::shrink <= static_cast<std::size_t>( shrink_type::level_2 ), "Shrink is not valid" );
+            static_assert( anixt_static_layout<Data>::value >= -1 && anixt_static_layout<Data>::value <= artlib_max_layout,
+                           "Layout is not valid" );
+            static_assert( anixt_static_letters_valid<Data>(), "Letters are not valid" );
+
+           private:
+            /**
+             * @brief stores anixt_config of font
+             **/
+            anixt_config config {};
+
+            /**
+             * @brief  finds entry of key
+             * @param  key key letter
+             * @return entry or nullptr
+             **/
+            static constexpr const anixt_static_entry *find( char_type key ) noexcept
+            {
+                std::size_t idx = static_cast<std::make_unsigned_t<char_type>>( key );
+
+                if ( idx >= std::size( Data::letters ) || !Data::letters[idx].found )
+                {
+                    return nullptr;
+                }
+
+                return Data::letters + idx;
+            }
+
+           public:
+            basic_anixt_static_font()
+            {
+                this->clear();
+            }
+
+            basic_anixt_static_font( const basic_anixt_static_font & )     = default;
+            basic_anixt_static_font( basic_anixt_static_font && ) noexcept = default;
+            ~basic_anixt_static_font()                                     = default;
+
+            basic_anixt_static_font &operator=( const basic_anixt_static_font & ) = default;
+            basic_anixt_static_font &operator=( basic_anixt_static_font && ) noexcept = default;
+
+            /**
+             * @brief  returns shared font without allocation, to
+             *         be used with set_font of basic_anixt
+             * @return shared font
+             **/
+            static std::shared_ptr<const basic_anixt_static_font> instance()
+            {
+                static const basic_anixt_static_font font;
+                return std::shared_ptr<const basic_anixt_static_font>( std::shared_ptr<void>(), &font );
+            }
+
+            /**
+             * @brief  checks letter is in font
+             * @param  key key letter
+             * @return true if found
+             **/
+            static constexpr bool contains( char_type key ) noexcept
+            {
+                return find( key ) != nullptr;
+            }
+
+            /**
+             * @brief clears the contents, contents of static
+             *         font are compiled in so it is set back
+             **/
+            void clear() noexcept override
+            {
+                this->config.HardBlank = Data::hardblank;
+                this->config.Height    = Data::height;
+                this->config.Shrink    = static_cast<shrink_type>( Data::shrink );
+                this->config.Layout    = anixt_static_layout<Data>::value;
+            }
+
+            /**
+             * @brief static font has no file
+             * @param fp full path to font file
+             **/
+            void set_font( const std::filesystem::path & ) override
+            {
+                throw std::runtime_error( "Static font can not be set from file" );
+            }
+
+            /**
+             * @brief  used to get anixt_config
+             * @return anixt_config
+             **/
+            anixt_config get_anixt_config() const override
+            {
+                return this->config;
+            }
+
+            /**
+             * @brief  tells font is validated, config and letters of
+             *         static font data are checked at compile time
+             * @return true
+             **/
+            bool validated() const noexcept override
+            {
+                return true;
+            }
+
+            /**
+             * @brief used to get anixt_glyph from font
+             * @param key key letter
+             * @return anixt_glyph
+             **/
+            anixt_glyph operator()( char_type key ) const override
+            {
+                const anixt_static_entry *entry = find( key );
+
+                if ( entry == nullptr )
+                {
+                    throw std::runtime_error( "Letter not found in font" );
+                }
+
+                return anixt_glyph { Data::rows + entry->offset, entry->width, Data::height,
+                                     Data::left + entry->edge, Data::right + entry->edge,
+                                     static_cast<std::make_unsigned_t<char_type>>( key ) };
+            }
+        };
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -10,7 +10,12 @@
 #ifndef BASIC_STYLE_HEADER
 #define BASIC_STYLE_HEADER
 
+#include "algorithm"
 #include "anixt_config.hpp"
+#include "array"
+#include "cstdint"
+#include "type_traits"
+#include "utility"
 
 /**
  * @namespace srilakshmikanthanp
@@ -57,13 +62,82 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get anixt_string asper the style
-             * @param  anixtletters vector of anixt_letters
+             * @param  anixtglyphs vector of anixt_glyphs
              * @return anixt_string
              **/
             virtual typename anixt_config::anixt_string
             operator()( const typename anixt_config::template vector_type<
-                        typename anixt_config::anixt_letter>
-                            &anixtletters ) = 0;
+                        typename anixt_config::anixt_glyph>
+                            &anixtglyphs ) = 0;
+
+            /**
+             * @brief used to render anixt_glyphs asper the style
+             *        in to canvas, buffer of canvas is reused
+             * @param anixtglyphs vector of anixt_glyphs
+             * @param canvas anixt_canvas to render in
+             **/
+            virtual void
+            operator()( const typename anixt_config::template vector_type<
+                        typename anixt_config::anixt_glyph>
+                            &anixtglyphs,
+                        typename anixt_config::anixt_canvas &canvas )
+            {
+                canvas = typename anixt_config::anixt_canvas( ( *this )( anixtglyphs ) );
+            }
+
+            /**
+             * @brief  width of anixt_string of anixt_glyphs asper the
+             *         style, styles find it without rendering where
+             *         they can
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            virtual typename anixt_config::size_type
+            measure( const typename anixt_config::template vector_type<
+                     typename anixt_config::anixt_glyph>
+                         &anixtglyphs )
+            {
+                typename anixt_config::anixt_canvas canvas;
+
+                ( *this )( anixtglyphs, canvas );
+
+                return canvas.width();
+            }
+
+            /**
+             * @brief  width of anixt_glyphs when last of them is
+             *         appended to anixt_glyphs of last call, measure
+             *         starts again when there is one glyph. styles
+             *         keep width of last call where they can
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            virtual typename anixt_config::size_type
+            measure_append( const typename anixt_config::template vector_type<
+                            typename anixt_config::anixt_glyph>
+                                &anixtglyphs )
+            {
+                return this->measure( anixtglyphs );
+            }
+
+            /**
+             * @brief  finds length of rows after each of anixt_glyphs
+             *         is placed when style places glyphs without ink
+             *         of one on other, so rows are ink of glyphs with
+             *         spaces between. width is length after last
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @param  ends length of rows after each glyph
+             * @return false if style does not place glyphs so, rows
+             *         are rendered then
+             **/
+            virtual bool
+            place( const typename anixt_config::template vector_type<
+                   typename anixt_config::anixt_glyph> &,
+                   typename anixt_config::template vector_type<
+                       typename anixt_config::size_type> & )
+            {
+                return false;
+            }
         };
 
         /**
@@ -78,15 +152,18 @@ namespace srilakshmikanthanp
             using base = basic_anixt_base_style<Anixtconfig>;
 
            public:
-            using anixt_config = typename base::anixt_config;
+            using anixt_config   = typename base::anixt_config;
+            using allocator_type = typename base::anixt_config::allocator_type;
 
            private:
-            using char_type    = typename base::anixt_config::char_type;
-            using size_type    = typename base::anixt_config::size_type;
-            using string_type  = typename base::anixt_config::string_type;
-            using shrink_type  = typename base::anixt_config::shrink;
-            using anixt_letter = typename base::anixt_config::anixt_letter;
-            using anixt_string = typename base::anixt_config::anixt_string;
+            using char_type        = typename base::anixt_config::char_type;
+            using size_type        = typename base::anixt_config::size_type;
+            using string_type      = typename base::anixt_config::string_type;
+            using string_view_type = typename base::anixt_config::string_view_type;
+            using shrink_type      = typename base::anixt_config::shrink;
+            using anixt_glyph      = typename base::anixt_config::anixt_glyph;
+            using anixt_string     = typename base::anixt_config::anixt_string;
+            using anixt_canvas     = typename base::anixt_config::anixt_canvas;
             template <typename T>
             using vector_type = typename base::anixt_config::template vector_type<T>;
 
@@ -98,6 +175,8 @@ namespace srilakshmikanthanp
 
            private:
             anixt_config config;
+            anixt_canvas scratch;
+            size_type    measured { 0 };
 
             /**
              * @brief converts ascii character of std::string
@@ -108,30 +187,6 @@ namespace srilakshmikanthanp
                 return string_type( str.begin(), str.end() );
             }
 
-            /**
-             * @brief checks the height are equal
-             * @param anixtletter obj of anixt_letter
-             **/
-            void error_check( const anixt_letter &anixtletter ) const
-            {
-                if ( anixtletter.size() != this->config.Height )
-                {
-                    throw std::runtime_error( "Height is not equal" );
-                }
-            }
-
-            /**
-             * @brief removes Hardblank
-             * @param as obj of anixt_string
-             **/
-            void remove_hardblank( anixt_string &as ) const
-            {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    std::replace( as[i].begin(), as[i].end(), this->config.HardBlank, ' ' );
-                }
-            }
-
            public:
             basic_anixt_untouched_style()                                          = default;
             basic_anixt_untouched_style( const basic_anixt_untouched_style & )     = default;
@@ -141,12 +196,24 @@ namespace srilakshmikanthanp
             basic_anixt_untouched_style &operator=( const basic_anixt_untouched_style & ) = default;
             basic_anixt_untouched_style &operator=( basic_anixt_untouched_style && ) noexcept = default;
 
+            /**
+             * @brief constructor, scratch of style is allocated by
+             *        alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_untouched_style( const allocator_type &alloc )
+                : scratch( alloc )
+            {
+            }
+
             /**
              * @brief clears the contents
              **/
             void clear() noexcept override
             {
                 this->config.clear();
+                this->scratch.clear();
+                this->measured = 0;
             }
 
             /**
@@ -157,6 +224,8 @@ namespace srilakshmikanthanp
             {
                 using std::swap;
                 swap( this->config, obj.config );
+                swap( this->scratch, obj.scratch );
+                swap( this->measured, obj.measured );
             }
 
             /**
@@ -171,29 +240,110 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get anixt_string in untouched style
-             * @param  anixtletters vector of anixt_letters
+             * @param  anixtglyphs vector of anixt_glyphs
              * @return anixt_string
              **/
-            anixt_string operator()( const vector_type<anixt_letter> &anixtletters ) override
+            anixt_string operator()( const vector_type<anixt_glyph> &anixtglyphs ) override
             {
-                anixt_string as( this->config.Height, cvt( "" ) );
+                anixt_string ret( this->scratch.get_allocator() );
 
-                for ( const auto &al : anixtletters )
+                ( *this )( anixtglyphs, this->scratch );
+
+                this->scratch.to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief used to render anixt_glyphs in untouched style
+             *        in to canvas
+             * @param anixtglyphs vector of anixt_glyphs
+             * @param canvas anixt_canvas to render in
+             **/
+            void operator()( const vector_type<anixt_glyph> &anixtglyphs, anixt_canvas &canvas ) override
+            {
+                size_type width = 0;
+
+                for ( const auto &al : anixtglyphs )
                 {
-                    error_check( al );
+                    width += al.width;
                 }
 
+                canvas.assign( width, this->config.Height, width );
+
+                // glyph rows are copied with Hardblank replaced in
+                // the same pass
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    for ( const auto &al : anixtletters )
+                    char_type *out = canvas.row_data( i );
+
+                    for ( const auto &al : anixtglyphs )
                     {
-                        as[i] += al[i];
+                        const string_view_type row = al[i];
+
+                        out = artlib_replace_copy( row.data(), row.data() + row.size(), out, this->config.HardBlank, char_type( ' ' ) );
                     }
                 }
+            }
+
+            /**
+             * @brief  width of anixt_glyphs in untouched style
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                size_type width = 0;
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    width += al.width;
+                }
+
+                return width;
+            }
+
+            /**
+             * @brief  width of anixt_glyphs when last of them is
+             *         appended, see basic_anixt_base_style
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure_append( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                if ( anixtglyphs.empty() )
+                {
+                    return this->measured = 0;
+                }
+
+                if ( anixtglyphs.size() == 1 )
+                {
+                    this->measured = 0;
+                }
+
+                return this->measured += anixtglyphs.back().width;
+            }
 
-                remove_hardblank( as );
+            /**
+             * @brief  finds length of rows after each of anixt_glyphs
+             *         in untouched style, glyphs are placed one after
+             *         other
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @param  ends length of rows after each glyph
+             * @return true
+             **/
+            bool place( const vector_type<anixt_glyph> &anixtglyphs, vector_type<size_type> &ends ) override
+            {
+                size_type width = 0;
+
+                ends.clear();
 
-                return as;
+                for ( const auto &al : anixtglyphs )
+                {
+                    ends.push_back( width += al.width );
+                }
+
+                return true;
             }
         };
 
@@ -222,15 +372,18 @@ namespace srilakshmikanthanp
             using base = basic_anixt_base_style<Anixtconfig>;
 
            public:
-            using anixt_config = typename base::anixt_config;
+            using anixt_config   = typename base::anixt_config;
+            using allocator_type = typename base::anixt_config::allocator_type;
 
            private:
             using char_type    = typename base::anixt_config::char_type;
             using size_type    = typename base::anixt_config::size_type;
+            using traits_type  = typename base::anixt_config::traits_type;
             using string_type  = typename base::anixt_config::string_type;
             using shrink_type  = typename base::anixt_config::shrink;
-            using anixt_letter = typename base::anixt_config::anixt_letter;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
             using anixt_string = typename base::anixt_config::anixt_string;
+            using anixt_canvas = typename base::anixt_config::anixt_canvas;
             template <typename T>
             using vector_type = typename base::anixt_config::template vector_type<T>;
 
@@ -241,9 +394,11 @@ namespace srilakshmikanthanp
             static constexpr shrink_type shrink_level = shrink_type::level_1;
 
            private:
-            const char_type null { '\0' };
-            const unsigned int kerning_space = Kerning;
-            anixt_config    config;
+            const unsigned int     kerning_space = Kerning;
+            anixt_config           config;
+            vector_type<size_type> marks;
+            vector_type<size_type> trail;
+            size_type              measured { 0 };
 
             /**
              * @brief converts ascii character of std::string
@@ -255,132 +410,82 @@ namespace srilakshmikanthanp
             }
 
             /**
-             * @brief checks the height are equal
-             * @param anixtletter obj of anixt_letter
+             * @brief  finds minspace between anixt_string and
+             *         anixt_glyph from trailing spaces of string
+             *         and left edges of glyph
+             * @param  trail trailing spaces of rows of string
+             * @param  al anixt_glyph
+             * @return minspace
              **/
-            void error_check( const anixt_letter &anixtletter ) const
+            size_type minspace( const vector_type<size_type> &trail, const anixt_glyph &al ) const
             {
-                if ( anixtletter.size() != this->config.Height )
-                {
-                    throw std::runtime_error( "Height is not equal" );
-                }
-            }
+                size_type ms = string_type::npos;
 
-            /**
-             * @brief removes Hardblank
-             * @param as obj of anixt_string
-             **/
-            void remove_hardblank( anixt_string &as ) const
-            {
-                for ( size_type i = 0; i < config.Height; i++ )
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    std::replace( as[i].begin(), as[i].end(), this->config.HardBlank, ' ' );
+                    ms = std::min( ms, trail[i] + al.left[i] );
                 }
-            }
 
-            /**
-             * @brief add null to last non white space char of 
-             *        anixt_string
-             * @param as anixt_string
-             **/
-            void append_null_to_anixt_string( anixt_string &as )
-            {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    size_type p = as[i].find_last_not_of( ' ' );
-
-                    if ( p == string_type::npos )
-                    {
-                        as[i] = string_type( 1, null ) + as[i];
-                    }
-                    else
-                    {
-                        as[i].insert( p + 1, 1, null );
-                    }
-                }
+                return ms;
             }
 
             /**
-             * @brief appends anixt_letter to anixt_string
-             * @param as anixt_string
-             * @param al anixt_letter
+             * @brief  does kening in canvas and anixt glyph, right
+             *         edges of canvas are kept in trail so shift of
+             *         glyph is known from minspace, glyph is written
+             *         once at its final column with Hardblank removed,
+             *         columns past end of rows are still blank
+             * @param  canvas anixt_canvas
+             * @param  len length of rows of canvas
+             * @param  trail trailing spaces of rows of canvas
+             * @param  al anixt_glyph
+             * @param  ms minspace of al
+             * @return new length of rows
              **/
-            void append_anixt_letter( anixt_string &as, anixt_letter al )
+            size_type fit_anixt_canvas_and_anixt_glyph( anixt_canvas &canvas, size_type len, vector_type<size_type> &trail,
+                                                        const anixt_glyph &al, size_type ms ) const
             {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    as[i] += al[i];
-                }
-            }
+                size_type ks = this->kerning_space;
 
-            /**
-             * @brief finds minspace between null
-             *        and non whitespace
-             * @param as anixt_string
-             **/
-            size_type minspace( anixt_string &as )
-            {
-                vector_type<size_type> nos( this->config.Height, 0 );
+                // glyph column j lands at column len + ks - ms + j,
+                // columns of glyph before end of ink of row and before
+                // column 0 are blank on both sides so they are skipped
+                size_type lead = len + ks;
 
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type p = as[i].find_first_of( null );
+                    size_type        at   = std::max( len - trail[i] + ms, lead ) - ms;
+                    size_type        skip = at + ms - lead;
+                    const char_type *src  = al[i].data();
 
-                    while ( ( ++p < as[i].size() ) && ( as[i][p] == ' ' ) )
-                    {
-                        ++nos[i];
-                    }
+                    artlib_replace_copy( src + skip, src + al.width, canvas.row_data( i ) + at,
+                                       this->config.HardBlank, char_type( ' ' ) );
                 }
 
-                return *std::min_element( nos.begin(), nos.end() );
+                return this->advance( len, trail, al, ms );
             }
 
             /**
-             * @brief does the kerning process
-             * @param as anixt_string 
-             * @param ms minspace
+             * @brief  moves trailing spaces of rows past anixt glyph
+             *         placed minspace left of end of rows
+             * @param  len length of rows
+             * @param  trail trailing spaces of rows
+             * @param  al anixt_glyph
+             * @param  ms minspace of al
+             * @return new length of rows
              **/
-            void kerning_process( anixt_string &as, size_type minspace )
+            size_type advance( size_type len, vector_type<size_type> &trail, const anixt_glyph &al, size_type ms ) const
             {
-                if ( minspace == this->kerning_space )
-                {
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = as[i].find_first_of( null );
-                        as[i].erase( p, 1 );
-                    }
-                }
-                else if ( minspace > kerning_space )
-                {
-                    size_type witdh = minspace - kerning_space;
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = as[i].find_first_of( null );
-                        as[i].erase( p, ( witdh + 1 ) );
-                    }
-                }
-                else
+                size_type ks = this->kerning_space;
+
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type witdh = kerning_space - minspace;
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = as[i].find_first_of( null );
-                        as[i].erase( p, 1 );
-                        as[i].insert( p, witdh, ' ' );
-                    }
+                    trail[i] = al.left[i] == al.width
+                                   ? trail[i] + al.width + ks - ms
+                                   : al.right[i];
                 }
-            }
 
-            /**
-             * @brief does kening in anixt string and anixt letter
-             * @param as anixt_string
-             * @param al anixt_letter
-             **/
-            void fit_anixt_string_and_anixt_letter( anixt_string &as, anixt_letter al )
-            {
-                append_null_to_anixt_string( as );
-                append_anixt_letter( as, al );
-                kerning_process( as, minspace( as ) );
+                return len + al.width + ks - ms;
             }
 
            public:
@@ -392,12 +497,26 @@ namespace srilakshmikanthanp
             basic_anixt_kerning_style &operator=( const basic_anixt_kerning_style & ) = default;
             basic_anixt_kerning_style &operator=( basic_anixt_kerning_style && ) noexcept = default;
 
+            /**
+             * @brief constructor, scratch of style is allocated by
+             *        alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_kerning_style( const allocator_type &alloc )
+                : marks( alloc ),
+                  trail( alloc )
+            {
+            }
+
             /**
              * @brief clears the contents
              **/
             void clear() noexcept override
             {
                 this->config.clear();
+                this->marks.clear();
+                this->trail.clear();
+                this->measured = 0;
             }
 
             /**
@@ -408,6 +527,9 @@ namespace srilakshmikanthanp
             {
                 using std::swap;
                 swap( this->config, obj.config );
+                swap( this->marks, obj.marks );
+                swap( this->trail, obj.trail );
+                swap( this->measured, obj.measured );
             }
 
             /**
@@ -422,26 +544,122 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get anixt_string in the fitted style
-             * @param  anixtletters vector of anixt_letters
+             * @param  anixtglyphs vector of anixt_glyphs
              * @return anixt_string
              **/
-            anixt_string operator()( const vector_type<anixt_letter> &anixtletters ) override
+            anixt_string operator()( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                anixt_canvas canvas( allocator_type( this->marks.get_allocator() ) );
+                anixt_string ret( canvas.get_allocator() );
+
+                ( *this )( anixtglyphs, canvas );
+
+                canvas.to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief used to render anixt_glyphs in fitted style in
+             *        to canvas, stride is bound of width so rows
+             *        grow in place
+             * @param anixtglyphs vector of anixt_glyphs
+             * @param canvas anixt_canvas to render in
+             **/
+            void operator()( const vector_type<anixt_glyph> &anixtglyphs, anixt_canvas &canvas ) override
+            {
+                vector_type<size_type> &trail = this->trail;
+                size_type               bound = 0;
+                size_type               len   = 0;
+
+                trail.assign( this->config.Height, 0 );
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    bound += al.width + this->kerning_space;
+                }
+
+                canvas.assign( 0, this->config.Height, bound );
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    len = fit_anixt_canvas_and_anixt_glyph( canvas, len, trail, al, this->minspace( trail, al ) );
+                }
+
+                canvas.set_width( len );
+            }
+
+            /**
+             * @brief  width of anixt_glyphs in fitted style, found
+             *         from widths and edges of glyphs alone
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                size_type len = 0;
+
+                this->marks.assign( this->config.Height, 0 );
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    len = this->advance( len, this->marks, al, this->minspace( this->marks, al ) );
+                }
+
+                return len;
+            }
+
+            /**
+             * @brief  width of anixt_glyphs when last of them is
+             *         appended, marks of rows are kept from last
+             *         call so glyph is fitted alone
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure_append( const vector_type<anixt_glyph> &anixtglyphs ) override
             {
-                anixt_string as( this->config.Height, cvt( "" ) );
+                size_type count = anixtglyphs.size();
 
-                for ( const auto &al : anixtletters )
+                if ( count <= 1 )
                 {
-                    error_check( al );
+                    this->marks.assign( this->config.Height, 0 );
+                    this->measured = 0;
                 }
 
-                for ( const auto &al : anixtletters )
+                if ( count == 0 )
                 {
-                    fit_anixt_string_and_anixt_letter( as, al );
+                    return 0;
                 }
 
-                remove_hardblank( as );
+                const anixt_glyph &al = anixtglyphs[count - 1];
+
+                return this->measured = this->advance( this->measured, this->marks, al, this->minspace( this->marks, al ) );
+            }
+
+            /**
+             * @brief  finds length of rows after each of anixt_glyphs
+             *         in fitted style from widths and edges of glyphs
+             *         alone, ink of fitted glyphs does not overlap
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @param  ends length of rows after each glyph
+             * @return true
+             **/
+            bool place( const vector_type<anixt_glyph> &anixtglyphs, vector_type<size_type> &ends ) override
+            {
+                size_type len = 0;
+
+                this->marks.assign( this->config.Height, 0 );
+
+                ends.clear();
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    len = this->advance( len, this->marks, al, this->minspace( this->marks, al ) );
+
+                    ends.push_back( len );
+                }
 
-                return as;
+                return true;
             }
         };
 
@@ -458,356 +676,1161 @@ namespace srilakshmikanthanp
         }
 
         /**
-         * @class  basic_anixt_smushed_style
-         * @brief  smushed style for anixt
-         * @tparam Anixtconfig type of anixt_config
+         * @brief  class of character in hierarchy smushing
+         * @param  ch character
+         * @return class, 0 if not in hierarchy
          **/
-        template <typename Anixtconfig>
-        class basic_anixt_smushed_style : public basic_anixt_base_style<Anixtconfig>
+        constexpr std::uint32_t anixt_smush_class( std::uint32_t ch ) noexcept
         {
-           protected:
-            using base = basic_anixt_base_style<Anixtconfig>;
+            switch ( ch )
+            {
+                case '|':
+                    return 1;
+                case '/':
+                case '\\':
+                    return 3;
+                case '[':
+                case ']':
+                    return 4;
+                case '{':
+                case '}':
+                    return 5;
+                case '(':
+                case ')':
+                    return 6;
+                default:
+                    return 0;
+            }
+        }
 
-           public:
-            using anixt_config = typename base::anixt_config;
+        /**
+         * @brief  smush rules
+         * @param  lc left character
+         * @param  rc right character
+         * @return smushed character
+         **/
+        constexpr std::uint32_t anixt_smush_rules( std::uint32_t lc, std::uint32_t rc ) noexcept
+        {
+            //()
+            if ( lc == ' ' )
+            {
+                return rc;
+            }
 
-           private:
-            using char_type    = typename base::anixt_config::char_type;
-            using size_type    = typename base::anixt_config::size_type;
-            using string_type  = typename base::anixt_config::string_type;
-            using shrink_type  = typename base::anixt_config::shrink;
-            using anixt_letter = typename base::anixt_config::anixt_letter;
-            using anixt_string = typename base::anixt_config::anixt_string;
-            template <typename T>
-            using vector_type = typename base::anixt_config::template vector_type<T>;
+            if ( rc == ' ' )
+            {
+                return lc;
+            }
 
-           public:
-            /**
-             * shrink level use by the style is level_2
-             **/
-            static constexpr shrink_type shrink_level = shrink_type::level_2;
+            //(Equal character smush )
+            if ( lc == rc )
+            {
+                return rc;
+            }
 
-           private:
-            const char_type null { '0' };
-            anixt_config    config;
+            //(Underscores smush)
+            if ( lc == '_' && ( rc == '<' || rc == '>' || anixt_smush_class( rc ) != 0 ) )
+            {
+                return rc;
+            }
 
-            /**
-             * @brief converts ascii character of std::string
-             *        to anixt_config::string_type
-             **/
-            static string_type cvt( const std::string &str )
+            if ( rc == '_' && ( lc == '<' || lc == '>' || anixt_smush_class( lc ) != 0 ) )
             {
-                return string_type( str.begin(), str.end() );
+                return lc;
             }
 
-            /**
-             * @brief checks the height are equal
-             * @param anixtletter obj of anixt_letter
-             **/
-            void error_check( const anixt_letter &anixtletter ) const
+            //(Hierarchy Smushing)
+            std::uint32_t c_lc = anixt_smush_class( lc );
+            std::uint32_t c_rc = anixt_smush_class( rc );
+
+            if ( c_lc > c_rc )
             {
-                if ( anixtletter.size() != this->config.Height )
-                {
-                    throw std::runtime_error( "Height is not equal" );
-                }
+                return lc;
             }
 
-            /**
-             * @brief removes Hardblank
-             * @param as obj of anixt_string
-             **/
-            void remove_hardblank( anixt_string &as ) const
+            if ( c_rc > c_lc )
             {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    std::replace( as[i].begin(), as[i].end(), this->config.HardBlank, ' ' );
-                }
+                return rc;
             }
 
-            /**
-             * @brief smush rules
-             * @param lc left character
-             * @param rc right character
-             * @return smushed character
-             **/
-            char_type smush_rules( char_type lc, char_type rc )
+            //(Opposite smush)
+            if ( ( lc == '[' && rc == ']' ) || ( lc == ']' && rc == '[' ) ||
+                 ( lc == '{' && rc == '}' ) || ( lc == '}' && rc == '{' ) ||
+                 ( lc == '(' && rc == ')' ) || ( lc == ')' && rc == '(' ) )
             {
-                //()
-                if ( lc == ' ' )
-                {
-                    return rc;
-                }
+                return '|';
+            }
 
-                if ( rc == ' ' )
-                {
-                    return lc;
-                }
+            //(Big X smush)
+            if ( lc == '/' && rc == '\\' )
+            {
+                return '|';
+            }
 
-                //(Equal character smush )
-                if ( lc == rc )
-                {
-                    return rc;
-                }
+            if ( lc == '\\' && rc == '/' )
+            {
+                return 'Y';
+            }
 
-                //(Underscores smush)
-                if ( lc == '_' &&
-                     cvt( "|/\\[]{}()<>" ).find( rc ) != string_type::npos )
-                {
-                    return rc;
-                }
+            if ( lc == '>' && rc == '<' )
+            {
+                return 'X';
+            }
 
-                if ( rc == '_' &&
-                     cvt( "|/\\[]{}()<>" ).find( lc ) != string_type::npos )
+            //(universel smush)
+            return lc;
+        }
+
+        /**
+         * @brief smush rules of all pair of byte characters, row
+         *        is left character and column is right character
+         **/
+        using anixt_smush_table_type = std::array<std::array<unsigned char, 256>, 256>;
+
+        /**
+         * @brief  makes table of smush rules
+         * @return anixt_smush_table_type
+         **/
+        constexpr anixt_smush_table_type anixt_make_smush_table() noexcept
+        {
+            anixt_smush_table_type table {};
+
+            for ( std::uint32_t lc = 0; lc < 256; lc++ )
+            {
+                for ( std::uint32_t rc = 0; rc < 256; rc++ )
+                {
+                    table[lc][rc] = static_cast<unsigned char>( anixt_smush_rules( lc, rc ) );
+                }
+            }
+
+            return table;
+        }
+
+        /**
+         * @brief table of smush rules built at compile time
+         **/
+        inline constexpr anixt_smush_table_type anixt_smush_table = anixt_make_smush_table();
+
+        /**
+         * @brief  smushes two characters, byte characters are
+         *         looked up in table
+         * @param  lc left character
+         * @param  rc right character
+         * @return smushed character
+         **/
+        template <typename CharT>
+        constexpr CharT anixt_smush( CharT lc, CharT rc ) noexcept
+        {
+            using unsigned_type = std::make_unsigned_t<CharT>;
+
+            auto l = static_cast<unsigned_type>( lc );
+            auto r = static_cast<unsigned_type>( rc );
+
+            if ( l < 256 && r < 256 )
+            {
+                return static_cast<CharT>( anixt_smush_table[l][r] );
+            }
+
+            return static_cast<CharT>( anixt_smush_rules( l, r ) );
+        }
+
+        /**
+         * @struct anixt_smush_rule
+         * @brief  horizontal smush rules of FIGlet as bits of rule
+         *         mask, equal to hardblank are bits 0 to 5 of full
+         *         layout. universal is FIGlet universal smushing
+         *         of layout without rules and artlib is the mix of
+         *         rules used by fonts without layout
+         **/
+        struct anixt_smush_rule
+        {
+            static constexpr unsigned int equal      = 1;
+            static constexpr unsigned int underscore = 2;
+            static constexpr unsigned int hierarchy  = 4;
+            static constexpr unsigned int opposite   = 8;
+            static constexpr unsigned int big_x      = 16;
+            static constexpr unsigned int hardblank  = 32;
+            static constexpr unsigned int universal  = 64;
+            static constexpr unsigned int artlib     = 128;
+
+            /**
+             * @brief  rule mask of FIGlet full layout
+             * @param  layout full layout, -1 if font has no layout
+             * @return rule mask
+             **/
+            static constexpr unsigned int of( long layout ) noexcept
+            {
+                if ( layout < 0 )
+                {
+                    return artlib;
+                }
+
+                unsigned int rules = static_cast<unsigned int>( layout ) & 63;
+
+                return rules != 0 ? rules : universal;
+            }
+        };
+
+        /**
+         * @brief  class of character in FIGlet hierarchy rule, <>
+         *         is highest class
+         * @param  ch character
+         * @return class, 0 if not in hierarchy
+         **/
+        constexpr std::uint32_t anixt_rule_class( std::uint32_t ch ) noexcept
+        {
+            return ch == '<' || ch == '>' ? 7 : anixt_smush_class( ch );
+        }
+
+        /**
+         * @brief  smushes two characters by rules of mask, rules
+         *         that are not in mask are compiled out
+         * @tparam Rules rule mask, see @ref anixt_smush_rule
+         * @param  lc left character
+         * @param  rc right character
+         * @param  hb HardBlank
+         * @param  out smushed character
+         * @return true if pair smushes
+         **/
+        template <unsigned int Rules, typename CharT>
+        constexpr bool anixt_smush_by( CharT lc, CharT rc, CharT hb, CharT &out ) noexcept
+        {
+            using rule = anixt_smush_rule;
+
+            if constexpr ( Rules == rule::artlib )
+            {
+                out = anixt_smush( lc, rc );
+
+                return ( lc != hb && rc != hb ) || lc == rc;
+            }
+            else
+            {
+                auto l = static_cast<std::uint32_t>( static_cast<std::make_unsigned_t<CharT>>( lc ) );
+                auto r = static_cast<std::uint32_t>( static_cast<std::make_unsigned_t<CharT>>( rc ) );
+
+                if ( l == ' ' )
+                {
+                    out = rc;
+                    return true;
+                }
+
+                if ( r == ' ' )
                 {
-                    return lc;
+                    out = lc;
+                    return true;
                 }
 
-                //(Hierarchy Smushing)
-                auto find_class = []( char_type ch ) -> size_type {
-                    if ( ch == '|' )
+                if constexpr ( Rules == rule::universal )
+                {
+                    out = rc == hb ? lc : rc;
+                    return true;
+                }
+
+                if ( lc == hb || rc == hb )
+                {
+                    out = lc;
+                    return ( Rules & rule::hardblank ) != 0 && lc == rc;
+                }
+
+                if constexpr ( ( Rules & rule::equal ) != 0 )
+                {
+                    if ( l == r )
                     {
-                        return 1;
+                        out = lc;
+                        return true;
                     }
+                }
 
-                    if ( ch == '/' || ch == '\\' )
+                if constexpr ( ( Rules & rule::underscore ) != 0 )
+                {
+                    if ( l == '_' && anixt_rule_class( r ) != 0 )
                     {
-                        return 3;
+                        out = rc;
+                        return true;
                     }
 
-                    if ( ch == '[' || ch == ']' )
+                    if ( r == '_' && anixt_rule_class( l ) != 0 )
                     {
-                        return 4;
+                        out = lc;
+                        return true;
                     }
+                }
 
-                    if ( ch == '{' || ch == '}' )
+                if constexpr ( ( Rules & rule::hierarchy ) != 0 )
+                {
+                    std::uint32_t c_lc = anixt_rule_class( l );
+                    std::uint32_t c_rc = anixt_rule_class( r );
+
+                    if ( c_lc != 0 && c_rc != 0 && c_lc != c_rc )
                     {
-                        return 5;
+                        out = c_lc > c_rc ? lc : rc;
+                        return true;
                     }
+                }
 
-                    if ( ch == '(' || ch == ')' )
+                if constexpr ( ( Rules & rule::opposite ) != 0 )
+                {
+                    if ( ( l == '[' && r == ']' ) || ( l == ']' && r == '[' ) ||
+                         ( l == '{' && r == '}' ) || ( l == '}' && r == '{' ) ||
+                         ( l == '(' && r == ')' ) || ( l == ')' && r == '(' ) )
                     {
-                        return 6;
+                        out = CharT( '|' );
+                        return true;
                     }
+                }
 
-                    return 0;
-                };
+                if constexpr ( ( Rules & rule::big_x ) != 0 )
+                {
+                    if ( l == '/' && r == '\\' )
+                    {
+                        out = CharT( '|' );
+                        return true;
+                    }
 
-                size_type c_lc = find_class( lc );
-                size_type c_rc = find_class( rc );
+                    if ( l == '\\' && r == '/' )
+                    {
+                        out = CharT( 'Y' );
+                        return true;
+                    }
 
-                if ( c_lc > c_rc )
-                {
-                    return lc;
+                    if ( l == '>' && r == '<' )
+                    {
+                        out = CharT( 'X' );
+                        return true;
+                    }
                 }
 
-                if ( c_rc > c_lc )
-                {
-                    return rc;
-                }
+                return false;
+            }
+        }
+
+        /**
+         * @class  basic_anixt_pair_table
+         * @brief  fit of pairs of printable ascii letters of font
+         *         for smushed style like kern table of typography,
+         *         filled lazily as pairs are rendered. entry keeps
+         *         minspace of rows where left letter has ink, rows
+         *         where it is blank are trailing spaces of letters
+         *         before pair that are checked on each use, so
+         *         smush of pair is kept only when they are 2 or more
+         *         apart. table is kept by style, not by font, as fit
+         *         depends on rules of style, and it is reset when
+         *         config is set.
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_pair_table
+        {
+           public:
+            using anixt_config   = Anixtconfig;
+            using allocator_type = typename anixt_config::allocator_type;
+
+           private:
+            using size_type   = typename anixt_config::size_type;
+            using string_type = typename anixt_config::string_type;
+            using anixt_glyph = typename anixt_config::anixt_glyph;
+            template <typename T>
+            using vector_type = typename anixt_config::template vector_type<T>;
+
+           public:
+            /**
+             * @enum  state
+             * @brief state of pair, unset till pair is rendered, none
+             *        if smush of pair depends on more than pair, fit
+             *        till pair is rendered with rows where left letter
+             *        is blank apart, smush or apart after that
+             **/
+            enum class state : unsigned char
+            {
+                unset,
+                none,
+                fit,
+                smush,
+                apart
+            };
+
+            /**
+             * @struct entry
+             * @brief  fit of pair
+             **/
+            struct entry
+            {
+                std::uint8_t space;
+                state        kind;
+            };
+
+            /**
+             * @brief first and last code in table
+             **/
+            static constexpr char32_t first = 0x20, last = 0x7E;
+
+           private:
+            /**
+             * @brief number of codes in table
+             **/
+            static constexpr char32_t span = last - first + 1;
+
+            /**
+             * @brief entries of pairs, left code is row
+             **/
+            vector_type<entry> entries;
+
+           public:
+            basic_anixt_pair_table()                                     = default;
+            basic_anixt_pair_table( const basic_anixt_pair_table & )     = default;
+            basic_anixt_pair_table( basic_anixt_pair_table && ) noexcept = default;
+            ~basic_anixt_pair_table()                                    = default;
+
+            basic_anixt_pair_table &operator=( const basic_anixt_pair_table & ) = default;
+            basic_anixt_pair_table &operator=( basic_anixt_pair_table && ) noexcept = default;
 
-                //(Opposite smush)
-                if ( lc == '[' && rc == ']' )
+            /**
+             * @brief constructor, entries are allocated by alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_pair_table( const allocator_type &alloc )
+                : entries( alloc )
+            {
+            }
+
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept
+            {
+                this->entries.clear();
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( basic_anixt_pair_table &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->entries, obj.entries );
+            }
+
+            /**
+             * @brief  entry of pair, table is allocated on first use
+             *         and unset entry is set from edges of pair
+             * @param  lhs left glyph
+             * @param  rhs right glyph
+             * @return entry or nullptr if pair is not in table
+             **/
+            entry *find( const anixt_glyph &lhs, const anixt_glyph &rhs )
+            {
+                char32_t l = lhs.code - first;
+                char32_t r = rhs.code - first;
+
+                if ( l >= span || r >= span )
                 {
-                    return '|';
+                    return nullptr;
                 }
 
-                if ( lc == ']' && rc == '[' )
+                if ( this->entries.empty() )
                 {
-                    return '|';
+                    this->entries.assign( span * span, entry { 0, state::unset } );
                 }
 
-                if ( lc == '{' && rc == '}' )
+                entry &pair = this->entries[l * span + r];
+
+                if ( pair.kind == state::unset )
                 {
-                    return '|';
+                    set( pair, lhs, rhs );
                 }
 
-                if ( lc == '}' && rc == '{' )
+                return &pair;
+            }
+
+           private:
+            /**
+             * @brief sets entry from edges of pair, space is minspace
+             *        of rows where lhs has ink. smush of pair can be
+             *        known from pair alone when rhs is blank only in
+             *        rows where lhs is blank and rows that meet at
+             *        space have last ink of lhs that is not its first
+             *        ink, first ink may be smushed already
+             * @param pair entry
+             * @param lhs left glyph
+             * @param rhs right glyph
+             **/
+            static void set( entry &pair, const anixt_glyph &lhs, const anixt_glyph &rhs ) noexcept
+            {
+                size_type space = string_type::npos;
+
+                for ( size_type i = 0; i < lhs.height; i++ )
                 {
-                    return '|';
+                    if ( lhs.left[i] != lhs.width )
+                    {
+                        space = std::min( space, lhs.right[i] + rhs.left[i] );
+                    }
                 }
 
-                if ( lc == '(' && rc == ')' )
+                bool kept = space <= 0xFF;
+
+                for ( size_type i = 0; i < lhs.height && kept; i++ )
                 {
-                    return '|';
+                    bool blank = lhs.left[i] == lhs.width;
+
+                    kept = rhs.left[i] == rhs.width ? blank
+                                                    : blank || lhs.right[i] + rhs.left[i] != space ||
+                                                          lhs.width - lhs.left[i] - lhs.right[i] >= 2;
                 }
 
-                if ( lc == ')' && rc == '(' )
+                pair.space = kept ? static_cast<std::uint8_t>( space ) : 0;
+                pair.kind  = kept ? state::fit : state::none;
+            }
+        };
+
+        /**
+         * @brief swap two basic_anixt_pair_table
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Anixtconfig>
+        void swap( basic_anixt_pair_table<Anixtconfig> &lhs,
+                   basic_anixt_pair_table<Anixtconfig> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+        /**
+         * @class  basic_anixt_smushed_style
+         * @brief  smushed style for anixt, smushing of rows is
+         *         compiled for each rule mask and picked by layout
+         *         of font
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_smushed_style : public basic_anixt_base_style<Anixtconfig>
+        {
+           protected:
+            using base = basic_anixt_base_style<Anixtconfig>;
+
+           public:
+            using anixt_config   = typename base::anixt_config;
+            using allocator_type = typename base::anixt_config::allocator_type;
+
+           private:
+            using char_type    = typename base::anixt_config::char_type;
+            using size_type    = typename base::anixt_config::size_type;
+            using traits_type  = typename base::anixt_config::traits_type;
+            using string_type  = typename base::anixt_config::string_type;
+            using shrink_type  = typename base::anixt_config::shrink;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
+            using anixt_string = typename base::anixt_config::anixt_string;
+            using anixt_canvas = typename base::anixt_config::anixt_canvas;
+            using pair_table   = basic_anixt_pair_table<Anixtconfig>;
+            using pair_state   = typename pair_table::state;
+            template <typename T>
+            using vector_type = typename base::anixt_config::template vector_type<T>;
+
+            /**
+             * @struct engine_type
+             * @brief  smushing of rows compiled for one rule mask,
+             *         check of rows and write of smushed rows.
+             *         capped if minspace is capped at width of glyph
+             *         as by FIGlet rules
+             **/
+            struct engine_type
+            {
+                bool ( basic_anixt_smushed_style::*smushes )( const anixt_canvas &, size_type, const vector_type<size_type> &,
+                                                               const anixt_glyph *, const anixt_glyph &, size_type ) const;
+                void ( basic_anixt_smushed_style::*smush_rows )( anixt_canvas &, size_type, const vector_type<size_type> &,
+                                                                  const anixt_glyph &, size_type ) const;
+                bool ( basic_anixt_smushed_style::*smushes_tails )( size_type, const anixt_glyph *, const anixt_glyph &, size_type, bool & ) const;
+                bool ( *smush )( char_type, char_type, char_type, char_type & ) noexcept;
+                bool capped;
+            };
+
+            /**
+             * @struct tail_type
+             * @brief  last two characters before end of ink of row
+             *         kept by measure, hardblank is not removed.
+             *         known is count of them that are known
+             **/
+            struct tail_type
+            {
+                char_type last;
+                char_type before;
+                size_type known;
+            };
+
+           public:
+            /**
+             * shrink level use by the style is level_2
+             **/
+            static constexpr shrink_type shrink_level = shrink_type::level_2;
+
+           private:
+            anixt_config           config;
+            pair_table             pairs;
+            engine_type            engine { select( -1 ) };
+            vector_type<size_type> marks;
+            vector_type<tail_type> tails;
+            vector_type<size_type> trail;
+            anixt_canvas           scratch;
+            size_type              measured { 0 };
+            bool                   exact { true };
+
+            /**
+             * @brief  rule mask of engine at index, 0 is universal,
+             *         1 to 63 are rules of layout and 64 is artlib
+             * @param  index index of engine
+             * @return rule mask
+             **/
+            static constexpr unsigned int rules_at( std::size_t index ) noexcept
+            {
+                return index == 0 ? anixt_smush_rule::universal
+                       : index < 64 ? static_cast<unsigned int>( index )
+                                    : anixt_smush_rule::artlib;
+            }
+
+            /**
+             * @brief  engines of all rule masks
+             * @return table of engines
+             **/
+            template <std::size_t... Index>
+            static constexpr std::array<engine_type, sizeof...( Index )> make_engines( std::index_sequence<Index...> ) noexcept
+            {
+                return { { engine_type { &basic_anixt_smushed_style::template smushes<rules_at( Index )>,
+                                         &basic_anixt_smushed_style::template smush_rows<rules_at( Index )>,
+                                         &basic_anixt_smushed_style::template smushes_tails<rules_at( Index )>,
+                                         &anixt_smush_by<rules_at( Index ), char_type>,
+                                         rules_at( Index ) != anixt_smush_rule::artlib }... } };
+            }
+
+            /**
+             * @brief  picks engine of layout from table
+             * @param  layout FIGlet full layout, -1 if font has none
+             * @return engine
+             **/
+            static engine_type select( long layout ) noexcept
+            {
+                static constexpr std::array<engine_type, 65> engines = make_engines( std::make_index_sequence<65>() );
+
+                return engines[layout < 0 ? 64 : static_cast<std::size_t>( layout & 63 )];
+            }
+
+            /**
+             * @brief converts ascii character of std::string
+             *        to anixt_config::string_type
+             **/
+            static string_type cvt( const std::string &str )
+            {
+                return string_type( str.begin(), str.end() );
+            }
+
+            /**
+             * @brief removes Hardblank
+             * @param canvas anixt_canvas
+             **/
+            void remove_hardblank( anixt_canvas &canvas ) const
+            {
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    return '|';
+                    char_type *row = canvas.row_data( i );
+
+                    artlib_replace( row, row + canvas.width(), this->config.HardBlank, char_type( ' ' ) );
                 }
+            }
+
+            /**
+             * @brief  finds minspace between anixt_string and
+             *         anixt_glyph from trailing spaces of string
+             *         and left edges of glyph, it is capped at width
+             *         of glyph by FIGlet rules
+             * @param  trail trailing spaces of rows of string
+             * @param  al anixt_glyph
+             * @return minspace
+             **/
+            size_type minspace( const vector_type<size_type> &trail, const anixt_glyph &al ) const
+            {
+                size_type ms = string_type::npos;
 
-                //(Big X smush)
-                if ( lc == '/' && rc == '\\' )
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    return '|';
+                    ms = std::min( ms, trail[i] + al.left[i] );
                 }
 
-                if ( lc == '\\' && rc == '/' )
+                return this->engine.capped ? std::min( ms, al.width ) : ms;
+            }
+
+            /**
+             * @brief  character of row after glyph is placed with
+             *         its first column at end - width, columns
+             *         before end of ink of row are from canvas
+             * @param  row row of canvas
+             * @param  ink end of ink of row
+             * @param  end end of row after glyph is placed
+             * @param  src row of glyph
+             * @param  width width of glyph
+             * @param  c column
+             * @return character
+             **/
+            static char_type placed( const char_type *row, size_type ink, size_type end,
+                                     const char_type *src, size_type width, size_type c ) noexcept
+            {
+                return c < ink ? row[c] : c + width >= end ? src[c + width - end] : char_type( ' ' );
+            }
+
+            /**
+             * @brief  checks glyph is kept apart by FIGlet rules, that
+             *         does not smush glyph narrower than 2 columns or
+             *         glyph after it, and glyph that is moved over
+             *         its width(minspace is capped at width)
+             * @param  len length of rows
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @param  end end of rows after glyph is placed
+             * @return true if glyphs are not smushed
+             **/
+            template <unsigned int Rules>
+            static constexpr bool apart( size_type len, const anixt_glyph *prev, const anixt_glyph &al, size_type end ) noexcept
+            {
+                if constexpr ( Rules == anixt_smush_rule::artlib )
                 {
-                    return 'Y';
+                    return false;
                 }
-
-                if ( lc == '>' && rc == '<' )
+                else
                 {
-                    return 'X';
+                    return al.width < 2 || ( prev != nullptr && prev->width < 2 ) || end == len;
                 }
-
-                //(universel smush)
-                return lc;
             }
 
             /**
-             * @brief add null to last non white space of 
-             *        anixt_string
-             * @param as anixt_string
+             * @brief  checks glyph placed with its first column at
+             *         end - width smushes with canvas, character before
+             *         first ink of glyph and the ink are smushed in all
+             *         rows or in none. blank row of glyph smushes last
+             *         two characters of row by artlib rules, by FIGlet
+             *         rules it only moves glyph by its gap so glyph is
+             *         not smushed if the gap is minspace
+             * @param  canvas anixt_canvas
+             * @param  len length of rows of canvas
+             * @param  trail trailing spaces of rows of canvas
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @param  end end of rows after glyph is placed
+             * @return true if rows smush
              **/
-            void append_null_to_anixt_string( anixt_string &as )
+            template <unsigned int Rules>
+            bool smushes( const anixt_canvas &canvas, size_type len, const vector_type<size_type> &trail,
+                          const anixt_glyph *prev, const anixt_glyph &al, size_type end ) const
             {
-                for ( size_type i = 0; i < config.Height; i++ )
+                char_type hb    = this->config.HardBlank;
+                size_type width = al.width;
+
+                if ( apart<Rules>( len, prev, al, end ) )
+                {
+                    return false;
+                }
+
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type p = as[i].find_last_not_of( ' ' );
+                    bool      blank = al.left[i] == width;
+                    size_type q     = blank ? end - 1 : end - width + al.left[i];
+
+                    if constexpr ( Rules != anixt_smush_rule::artlib )
+                    {
+                        if ( blank && end == len - trail[i] )
+                        {
+                            return false;
+                        }
+
+                        if ( blank )
+                        {
+                            continue;
+                        }
+                    }
 
-                    if ( p == string_type::npos )
+                    if ( blank ? end < 2 : q == 0 )
                     {
-                        as[i] = string_type( 1, null ) + as[i];
+                        return false;
                     }
-                    else
+
+                    const char_type *row = canvas.row_data( i );
+                    const char_type *src = al[i].data();
+                    size_type        ink = len - trail[i];
+                    char_type        lc  = placed( row, ink, end, src, width, q - 1 );
+                    char_type        rc  = placed( row, ink, end, src, width, q );
+                    char_type        out = lc;
+
+                    if ( !anixt_smush_by<Rules>( lc, rc, hb, out ) )
                     {
-                        as[i].insert( p + 1, 1, null );
+                        return false;
                     }
                 }
+
+                return true;
             }
 
             /**
-             * @brief add null to anixt_letter after first non
-             *        whitespace
-             * @param al anixt_letter
+             * @brief smushes glyph placed with its first column at
+             *        end - width in to rows of canvas, smushed
+             *        character is written before first ink of glyph
+             *        and rest of glyph is written once after it
+             * @param canvas anixt_canvas
+             * @param len length of rows of canvas
+             * @param trail trailing spaces of rows of canvas
+             * @param al anixt_glyph
+             * @param end end of rows after glyph is placed
              **/
-            void append_null_to_anixt_letter( anixt_letter &al )
+            template <unsigned int Rules>
+            void smush_rows( anixt_canvas &canvas, size_type len, const vector_type<size_type> &trail,
+                             const anixt_glyph &al, size_type end ) const
             {
+                size_type width = al.width;
+
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type p = al[i].find_first_not_of( ' ' );
+                    char_type *      row   = canvas.row_data( i );
+                    const char_type *src   = al[i].data();
+                    size_type        ink   = len - trail[i];
+                    bool             blank = al.left[i] == width;
+                    size_type        q     = blank ? end - 1 : end - width + al.left[i];
+                    char_type        lc    = placed( row, ink, end, src, width, q - 1 );
+                    char_type        rc    = placed( row, ink, end, src, width, q );
 
-                    if ( p == string_type::npos )
-                    {
-                        al[i] = al[i] + string_type( 1, '0' );
-                    }
-                    else
+                    anixt_smush_by<Rules>( lc, rc, this->config.HardBlank, row[q - 1] );
+
+                    if ( !blank )
                     {
-                        al[i].insert( p + 1, 1, '0' );
+                        traits_type::copy( row + q, src + al.left[i] + 1, width - al.left[i] - 1 );
                     }
+
+                    row[end - 1] = char_type( ' ' );
                 }
             }
 
             /**
-             * @brief appends anixt_letter to anixt_string
-             * @param as anixt_string
-             * @param al anixt_letter
+             * @brief  finds minspace of glyph after prev, it is from
+             *         pair table and rows where prev is blank if pair
+             *         is in table
+             * @param  trail trailing spaces of rows of string
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @param  ms set to minspace
+             * @return entry of pair if rows where prev is blank are
+             *         2 or more apart so smush of pair is known from
+             *         it, else nullptr
              **/
-            void append_anixt_letter( anixt_string &as, anixt_letter al )
+            typename pair_table::entry *minspace( const vector_type<size_type> &trail, const anixt_glyph *prev,
+                                                  const anixt_glyph &al, size_type &ms )
             {
-                for ( size_type i = 0; i < config.Height; i++ )
+                auto *pair = prev != nullptr ? this->pairs.find( *prev, al ) : nullptr;
+
+                if ( pair == nullptr || pair->kind == pair_state::none )
                 {
-                    as[i] += al[i];
+                    ms = this->minspace( trail, al );
+                    return nullptr;
                 }
+
+                size_type gap = string_type::npos;
+
+                for ( size_type i = 0; i < this->config.Height; i++ )
+                {
+                    if ( prev->left[i] == prev->width )
+                    {
+                        gap = std::min( gap, trail[i] + al.left[i] );
+                    }
+                }
+
+                ms = std::min( size_type( pair->space ), gap );
+                ms = this->engine.capped ? std::min( ms, al.width ) : ms;
+
+                return gap - ms >= 2 ? pair : nullptr;
             }
 
             /**
-             * @brief finds minspace between null
-             *        and non whitespace
-             * @param as anixt_string
+             * @brief  smush canvas and anixt glyph, glyph is placed
+             *         minspace left of end of rows. character before
+             *         first ink of glyph and the ink are smushed in
+             *         to one in all rows(last two characters if row
+             *         of glyph is blank) or in none, that is decided
+             *         from edges before glyph is written once at its
+             *         final column.
+             * @param  canvas anixt_canvas
+             * @param  len length of rows of canvas
+             * @param  trail trailing spaces of rows of canvas
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @return new length of rows
              **/
-            size_type minspace( anixt_string &as )
+            size_type smush_anixt_canvas_and_anixt_glyph( anixt_canvas &canvas, size_type len, vector_type<size_type> &trail,
+                                                          const anixt_glyph *prev, const anixt_glyph &al )
             {
-                vector_type<size_type> nos( this->config.Height, 0 );
+                size_type  ms    = 0;
+                auto *     pair  = this->minspace( trail, prev, al, ms );
+                pair_state kind  = pair != nullptr ? pair->kind : pair_state::none;
+                size_type  width = al.width;
+                size_type  end   = len + width - ms;
 
-                for ( size_type i = 0; i < this->config.Height; i++ )
+                bool smushed = kind == pair_state::smush   ? true
+                               : kind == pair_state::apart ? false
+                                                           : ( this->*this->engine.smushes )( canvas, len, trail, prev, al, end );
+
+                if ( kind == pair_state::fit )
+                {
+                    pair->kind = smushed ? pair_state::smush : pair_state::apart;
+                }
+
+                if ( smushed )
                 {
-                    size_type p = as[i].find_first_of( null );
+                    ( this->*this->engine.smush_rows )( canvas, len, trail, al, end );
+                }
 
-                    while ( ( ++p < as[i].size() ) && ( as[i][p] == ' ' ) )
+                for ( size_type i = 0; i < this->config.Height; i++ )
+                {
+                    if ( !smushed )
                     {
-                        ++nos[i];
+                        size_type skip = std::max( len - trail[i] + width, end ) - end;
+
+                        traits_type::copy( canvas.row_data( i ) + ( end + skip - width ), al[i].data() + skip, width - skip );
                     }
+
+                    size_type u = trail[i] + width - ms;
+
+                    trail[i] = al.left[i] != width ? al.right[i]
+                               : smushed             ? std::max<size_type>( u, 1 ) - 1
+                                                     : u;
                 }
 
-                return *std::min_element( nos.begin(), nos.end() );
+                return smushed ? end - 1 : end;
             }
 
             /**
-             * @brief removes minspace and null
-             * @param as anixt_string 
-             * @param ms minspace
+             * @brief  character of row at column c from its tail,
+             *         columns from end of ink are blank
+             * @param  tail tail of row
+             * @param  ink end of ink of row
+             * @param  c column
+             * @param  out character
+             * @return false if character is not kept in tail
              **/
-            void remove_null_and_minspace( anixt_string &as, size_type ms )
+            static bool tail_at( const tail_type &tail, size_type ink, size_type c, char_type &out ) noexcept
             {
-                for ( size_type i = 0; i < this->config.Height; i++ )
+                if ( c >= ink )
                 {
-                    size_type p = as[i].find_first_of( null );
-                    as[i].erase( p, ( ms + 1 ) );
+                    out = char_type( ' ' );
+                    return true;
                 }
+
+                if ( ink - c > tail.known )
+                {
+                    return false;
+                }
+
+                out = ink - c == 1 ? tail.last : tail.before;
+
+                return true;
             }
 
             /**
-             * @brief do's the smushing work
+             * @brief  same as placed but columns before end of ink
+             *         are from tail of row
+             * @param  tail tail of row
+             * @param  ink end of ink of row
+             * @param  end end of row after glyph is placed
+             * @param  src row of glyph
+             * @param  width width of glyph
+             * @param  c column
+             * @param  out character
+             * @return false if character is not kept in tail
              **/
-            void do_smushing_work_in_anixt_string( anixt_string &as )
+            static bool placed_tail( const tail_type &tail, size_type ink, size_type end,
+                                     const char_type *src, size_type width, size_type c, char_type &out ) noexcept
             {
-                vector_type<std::pair<size_type, size_type>> cp;
-
-                for ( size_type i = 0; i < this->config.Height; i++ )
+                if ( c < ink )
                 {
-                    std::pair<size_type, size_type> charpos;
-                    size_type                       nullpos;
-                    nullpos        = as[i].find_last_of( null );
-                    charpos.first  = nullpos - 2;
-                    charpos.second = nullpos - 1;
-                    as[i].erase( nullpos, 1 );
-                    cp.push_back( charpos );
+                    return tail_at( tail, ink, c, out );
                 }
 
-                for ( size_type i = 0; i < this->config.Height; i++ )
+                out = c + width >= end ? src[c + width - end] : char_type( ' ' );
+
+                return true;
+            }
+
+            /**
+             * @brief  checks anixt glyph placed with its first column
+             *         at end - width smushes with rows kept in marks
+             *         and tails, same as smushes
+             * @param  len length of rows
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @param  end end of rows after glyph is placed
+             * @param  smushed set to true if rows smush
+             * @return false if a character that decides smush is
+             *         not kept in tails
+             **/
+            template <unsigned int Rules>
+            bool smushes_tails( size_type len, const anixt_glyph *prev, const anixt_glyph &al, size_type end, bool &smushed ) const
+            {
+                char_type hb    = this->config.HardBlank;
+                size_type width = al.width;
+
+                smushed = !apart<Rules>( len, prev, al, end );
+
+                for ( size_type i = 0; i < this->config.Height && smushed; i++ )
                 {
-                    try
+                    bool      blank = al.left[i] == width;
+                    size_type q     = blank ? end - 1 : end - width + al.left[i];
+                    size_type ink   = len - this->marks[i];
+                    char_type lc    = char_type( ' ' );
+                    char_type rc    = char_type( ' ' );
+                    char_type out   = char_type( ' ' );
+
+                    if constexpr ( Rules != anixt_smush_rule::artlib )
                     {
-                        char_type hb = this->config.HardBlank;
-                        char_type lc = as[i].at( cp[i].first );
-                        char_type rc = as[i].at( cp[i].second );
-
-                        if ( ( lc == hb || rc == hb ) && ( lc != rc ) )
+                        if ( blank )
                         {
-                            throw "";
+                            smushed = end != ink;
+                            continue;
                         }
                     }
-                    catch ( ... )
+
+                    if ( blank ? end < 2 : q == 0 )
+                    {
+                        smushed = false;
+                        break;
+                    }
+
+                    if ( !placed_tail( this->tails[i], ink, end, al[i].data(), width, q - 1, lc ) ||
+                         !placed_tail( this->tails[i], ink, end, al[i].data(), width, q, rc ) )
                     {
-                        return;
+                        return false;
                     }
+
+                    smushed = anixt_smush_by<Rules>( lc, rc, hb, out );
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief  moves marks and tails of rows past anixt glyph
+             *         as smush_anixt_canvas_and_anixt_glyph moves the
+             *         rows of canvas, rows are not written
+             * @param  len length of rows, set to new length
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @return false if a character that decides smush is
+             *         not kept in tails
+             **/
+            bool measure_anixt_glyph( size_type &len, const anixt_glyph *prev, const anixt_glyph &al )
+            {
+                size_type  ms      = 0;
+                auto *     pair    = this->minspace( this->marks, prev, al, ms );
+                pair_state kind    = pair != nullptr ? pair->kind : pair_state::none;
+                char_type  hb      = this->config.HardBlank;
+                size_type  width   = al.width;
+                size_type  end     = len + width - ms;
+                bool       smushed = kind == pair_state::smush;
+
+                if ( kind != pair_state::smush && kind != pair_state::apart && !( this->*this->engine.smushes_tails )( len, prev, al, end, smushed ) )
+                {
+                    return false;
+                }
+
+                if ( kind == pair_state::fit )
+                {
+                    pair->kind = smushed ? pair_state::smush : pair_state::apart;
                 }
 
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    char_type lc = as[i][cp[i].first];
-                    char_type rc = as[i][cp[i].second];
-                    char_type sm = smush_rules( lc, rc );
-                    as[i].erase( cp[i].first, 2 );
-                    as[i].insert( cp[i].first, 1, sm );
+                    const char_type *src   = al[i].data();
+                    tail_type &      tail  = this->tails[i];
+                    size_type        q     = al.left[i] == width ? end - 1 : end - width + al.left[i];
+                    size_type        ink   = len - this->marks[i];
+                    size_type        u     = this->marks[i] + width - ms;
+                    char_type        sm    = char_type( ' ' );
+
+                    // blank row of glyph keeps characters of row, they
+                    // are moved only when last two of them are smushed
+                    if ( al.left[i] == width )
+                    {
+                        this->marks[i] = smushed ? std::max<size_type>( u, 1 ) - 1 : u;
+
+                        if ( smushed && u == 0 )
+                        {
+                            this->engine.smush( tail.before, tail.last, hb, sm );
+
+                            tail = tail_type { sm, char_type( ' ' ), 1 };
+                        }
+
+                        continue;
+                    }
+
+                    size_type ends = width - al.right[i];
+                    size_type lead = ends - al.left[i];
+
+                    if ( smushed && lead <= 2 )
+                    {
+                        char_type lc = char_type( ' ' ), rc = char_type( ' ' );
+
+                        placed_tail( tail, ink, end, src, width, q - 1, lc );
+                        placed_tail( tail, ink, end, src, width, q, rc );
+
+                        this->engine.smush( lc, rc, hb, sm );
+                    }
+
+                    char_type last   = smushed && lead == 1 ? sm : src[ends - 1];
+                    char_type before = char_type( ' ' );
+
+                    // ink of one character takes character before it
+                    // from row, that is before q - 1 if it is smushed
+                    size_type c     = smushed ? q - 1 : q;
+                    size_type known = lead >= 2 ? 2 : c >= 1 && tail_at( tail, ink, c - 1, before ) ? 2 : 1;
+
+                    if ( lead >= 2 )
+                    {
+                        before = smushed && lead == 2 ? sm : src[ends - 2];
+                    }
+
+                    tail           = tail_type { last, before, known };
+                    this->marks[i] = al.right[i];
                 }
+
+                len = smushed ? end - 1 : end;
+
+                return true;
             }
 
             /**
-             * @brief smush anixt string and anixt letter
-             * @param as anixt_string
-             * @param al anixt_letter
+             * @brief  appends anixt glyph to rows of canvas kept for
+             *         measure, marks are trailing spaces of its rows.
+             *         stride of canvas is doubled when glyph does not
+             *         fit so appending glyphs one by one is linear
+             * @param  prev glyph before al, nullptr if none
+             * @param  al anixt_glyph
+             * @return width of rows
              **/
-            void smush_anixt_string_and_anixt_letter( anixt_string &as, anixt_letter al )
+            size_type measure_scratch( const anixt_glyph *prev, const anixt_glyph &al )
             {
-                append_null_to_anixt_string( as );
-                append_null_to_anixt_letter( al );
-                append_anixt_letter( as, al );
-                remove_null_and_minspace( as, minspace( as ) );
-                do_smushing_work_in_anixt_string( as );
+                anixt_canvas &canvas = this->scratch;
+                size_type     len    = canvas.width();
+
+                if ( len + al.width > canvas.stride() )
+                {
+                    anixt_canvas grown( canvas.get_allocator() );
+
+                    grown.assign( len, this->config.Height, std::max( 2 * canvas.stride(), len + al.width ) );
+
+                    for ( size_type i = 0; i < this->config.Height; i++ )
+                    {
+                        traits_type::copy( grown.row_data( i ), canvas.row_data( i ), len );
+                    }
+
+                    canvas.swap( grown );
+                }
+
+                len = this->smush_anixt_canvas_and_anixt_glyph( canvas, len, this->marks, prev, al );
+
+                canvas.set_width( len );
+
+                return len;
             }
 
            public:
@@ -819,12 +1842,34 @@ namespace srilakshmikanthanp
             basic_anixt_smushed_style &operator=( const basic_anixt_smushed_style & ) = default;
             basic_anixt_smushed_style &operator=( basic_anixt_smushed_style && ) noexcept = default;
 
+            /**
+             * @brief constructor, scratch of style is allocated by
+             *        alloc
+             * @param alloc allocator
+             **/
+            explicit basic_anixt_smushed_style( const allocator_type &alloc )
+                : pairs( alloc ),
+                  marks( alloc ),
+                  tails( alloc ),
+                  trail( alloc ),
+                  scratch( alloc )
+            {
+            }
+
             /**
              * @brief clears the contents
              **/
             void clear() noexcept override
             {
                 this->config.clear();
+                this->pairs.clear();
+                this->engine = select( -1 );
+                this->marks.clear();
+                this->tails.clear();
+                this->trail.clear();
+                this->scratch.clear();
+                this->measured = 0;
+                this->exact    = true;
             }
 
             /**
@@ -835,39 +1880,175 @@ namespace srilakshmikanthanp
             {
                 using std::swap;
                 swap( this->config, obj.config );
+                swap( this->pairs, obj.pairs );
+                swap( this->engine, obj.engine );
+                swap( this->marks, obj.marks );
+                swap( this->tails, obj.tails );
+                swap( this->trail, obj.trail );
+                swap( this->scratch, obj.scratch );
+                swap( this->measured, obj.measured );
+                swap( this->exact, obj.exact );
             }
 
             /**
-             * @brief  used to set anixt config
+             * @brief  used to set anixt config, engine of rules
+             *         of Layout is picked
              * @param  config anixt_config
              **/
             void set_config( const anixt_config &config ) noexcept override
             {
                 this->config = config;
+                this->pairs.clear();
+                this->engine = select( config.Layout );
             }
 
             /**
              * @brief  used to get anixt_string in the smushed style
-             * @param  anixtletters vector of anixt_letters
+             * @param  anixtglyphs vector of anixt_glyphs
              * @return anixt_string
              **/
-            anixt_string operator()( const vector_type<anixt_letter> &anixtletters ) override
+            anixt_string operator()( const vector_type<anixt_glyph> &anixtglyphs ) override
             {
-                anixt_string as( this->config.Height, cvt( "" ) );
+                anixt_canvas canvas( this->scratch.get_allocator() );
+                anixt_string ret( canvas.get_allocator() );
 
-                for ( const auto &al : anixtletters )
+                ( *this )( anixtglyphs, canvas );
+
+                canvas.to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief used to render anixt_glyphs in smushed style in
+             *        to canvas, stride is bound of width so rows
+             *        change in place
+             * @param anixtglyphs vector of anixt_glyphs
+             * @param canvas anixt_canvas to render in
+             **/
+            void operator()( const vector_type<anixt_glyph> &anixtglyphs, anixt_canvas &canvas ) override
+            {
+                vector_type<size_type> &trail = this->trail;
+                size_type               bound = 0;
+                size_type               len   = 0;
+
+                trail.assign( this->config.Height, 0 );
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    bound += al.width;
+                }
+
+                canvas.assign( 0, this->config.Height, bound );
+
+                const anixt_glyph *prev = nullptr;
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    len  = smush_anixt_canvas_and_anixt_glyph( canvas, len, trail, prev, al );
+                    prev = &al;
+                }
+
+                canvas.set_width( len );
+
+                remove_hardblank( canvas );
+            }
+
+            /**
+             * @brief  width of anixt_glyphs in smushed style, found
+             *         from widths, edges and the characters where
+             *         glyphs meet that are kept in tails of rows.
+             *         blank rows of glyphs may smush characters
+             *         of rows that are before tails, then glyphs are
+             *         rendered in to canvas kept for measure which
+             *         may allocate
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                size_type len = 0;
+
+                this->marks.assign( this->config.Height, 0 );
+                this->tails.assign( this->config.Height, tail_type { char_type( ' ' ), char_type( ' ' ), 0 } );
+
+                const anixt_glyph *prev = nullptr;
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    if ( !this->measure_anixt_glyph( len, prev, al ) )
+                    {
+                        ( *this )( anixtglyphs, this->scratch );
+
+                        return this->scratch.width();
+                    }
+
+                    prev = &al;
+                }
+
+                return len;
+            }
+
+            /**
+             * @brief  width of anixt_glyphs when last of them is
+             *         appended, marks and tails of rows are kept
+             *         from last call so glyph is smushed alone. once
+             *         tails can not tell width glyphs are rendered
+             *         in to canvas kept for measure and later glyphs
+             *         are appended to it till measure starts again,
+             *         the canvas grows so it may allocate
+             * @param  anixtglyphs vector of anixt_glyphs
+             * @return width
+             **/
+            size_type measure_append( const vector_type<anixt_glyph> &anixtglyphs ) override
+            {
+                size_type count = anixtglyphs.size();
+
+                if ( count <= 1 )
+                {
+                    this->marks.assign( this->config.Height, 0 );
+                    this->tails.assign( this->config.Height, tail_type { char_type( ' ' ), char_type( ' ' ), 0 } );
+                    this->measured = 0;
+                    this->exact    = true;
+                }
+
+                if ( count == 0 )
                 {
-                    error_check( al );
+                    return 0;
                 }
 
-                for ( const auto &al : anixtletters )
+                const anixt_glyph *prev = count > 1 ? &anixtglyphs[count - 2] : nullptr;
+
+                if ( !this->exact )
                 {
-                    smush_anixt_string_and_anixt_letter( as, al );
+                    return this->measure_scratch( prev, anixtglyphs[count - 1] );
                 }
 
-                remove_hardblank( as );
+                if ( this->measure_anixt_glyph( this->measured, prev, anixtglyphs[count - 1] ) )
+                {
+                    return this->measured;
+                }
+
+                size_type bound = 0;
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    bound += al.width;
+                }
+
+                this->exact = false;
+                this->scratch.assign( 0, this->config.Height, 2 * bound );
+                this->marks.assign( this->config.Height, 0 );
+
+                prev = nullptr;
+
+                for ( const auto &al : anixtglyphs )
+                {
+                    this->measure_scratch( prev, al );
+                    prev = &al;
+                }
 
-                return as;
+                return this->scratch.width();
             }
         };
 
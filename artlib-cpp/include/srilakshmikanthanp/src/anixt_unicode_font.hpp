@@ -0,0 +1,420 @@
+///@file anixt_unicode_font.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ANIXT_UNICODE_FONT_HEADER
+#define ANIXT_UNICODE_FONT_HEADER
+
+#include "anixt_flf_font.hpp"
+#include "anixt_font.hpp"
+#include "anixt_mmap_font.hpp"
+#include "artlib_unicode.hpp"
+#include "cstdint"
+#include "list"
+#include "memory"
+#include "mutex"
+#include "unordered_map"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  basic_anixt_unicode_font
+         * @brief  This class reads large FIGlet font(.flf) for
+         *         anixt class lazily, load only indexes position
+         *         of letters by codepoint, letters are decoded
+         *         from the mapping on first use and kept in a
+         *         bounded least recently used cache.
+         *
+         *         glyphs are valid till next lookup evicts them,
+         *         pin the font to keep them valid longer, cache
+         *         is trimmed back to capacity on last unpin.
+         * @tparam Anixtconfig type of anixt_config
+         **/
+        template <typename Anixtconfig>
+        class basic_anixt_unicode_font : public basic_anixt_base_font<Anixtconfig>
+        {
+           protected:
+            using base = basic_anixt_base_font<Anixtconfig>;
+
+           public:
+            using anixt_config = typename base::anixt_config;
+
+           private:
+            using char_type    = typename base::anixt_config::char_type;
+            using size_type    = typename base::anixt_config::size_type;
+            using string_type  = typename base::anixt_config::string_type;
+            using shrink_type  = typename base::anixt_config::shrink;
+            using anixt_glyph  = typename base::anixt_config::anixt_glyph;
+            using byte_type    = unsigned char;
+            template <typename T>
+            using vector_type = typename base::anixt_config::template vector_type<T>;
+            template <typename T>
+            using alloc_type = typename base::anixt_config::template alloc_type<T>;
+            using index_type = artlib_page_table<std::uint32_t, alloc_type>;
+
+           public:
+            /**
+             * @brief default number of letters in cache
+             **/
+            static constexpr size_type default_capacity = 1024;
+
+           private:
+            /**
+             * @struct entry
+             * @brief  decoded letter in cache
+             **/
+            struct entry
+            {
+                std::uint32_t          letter;
+                size_type              width;
+                string_type            rows;
+                vector_type<size_type> left, right;
+            };
+
+            using cache_type = std::list<entry, alloc_type<entry>>;
+            using slot_type  = std::unordered_map<std::uint32_t, typename cache_type::iterator, std::hash<std::uint32_t>,
+                                                 std::equal_to<std::uint32_t>,
+                                                 alloc_type<std::pair<const std::uint32_t, typename cache_type::iterator>>>;
+
+            /**
+             * @brief mapping of font file
+             **/
+            std::shared_ptr<const byte_type> mapping;
+
+            /**
+             * @brief size of mapping
+             **/
+            std::size_t size { 0 };
+
+            /**
+             * @brief stores anixt_config of font
+             **/
+            anixt_config config {};
+
+            /**
+             * @brief stores codepoint to letter number
+             **/
+            index_type index;
+
+            /**
+             * @brief offset of first row of letter in mapping
+             **/
+            vector_type<std::uint64_t> offsets;
+
+            /**
+             * @brief maximum letters kept in cache when not pinned
+             **/
+            size_type capacity { default_capacity };
+
+            /**
+             * @brief guards cache as shared font is used from
+             *        many threads
+             **/
+            mutable std::mutex mutex;
+
+            /**
+             * @brief decoded letters, most recently used first
+             **/
+            mutable cache_type cache;
+
+            /**
+             * @brief letter number to position in cache
+             **/
+            mutable slot_type slots;
+
+            /**
+             * @brief number of pins held
+             **/
+            mutable size_type pins { 0 };
+
+            /**
+             * @brief drops least recently used letters till
+             *        cache has at most count letters
+             * @param count letters to keep
+             **/
+            void trim( size_type count ) const noexcept
+            {
+                while ( this->cache.size() > count )
+                {
+                    this->slots.erase( this->cache.back().letter );
+                    this->cache.pop_back();
+                }
+            }
+
+            /**
+             * @brief  decodes letter from mapping
+             * @param  letter letter number
+             * @return decoded letter
+             **/
+            entry decode( std::uint32_t letter ) const
+            {
+                const char *      data = reinterpret_cast<const char *>( this->mapping.get() );
+                anixt_flf_scanner scan( data, this->size );
+                size_type         height = this->config.Height;
+                entry             ret { letter, 0, {}, {}, {} };
+
+                vector_type<const char *> lines( height * 2 );
+
+                scan.seek( this->offsets[letter] );
+                ret.width = scan.rows( height, lines );
+                ret.rows.reserve( ret.width * height );
+
+                for ( size_type i = 0; i < height; i++ )
+                {
+                    const char *begin = lines[i * 2];
+                    const char *end   = lines[i * 2 + 1];
+
+                    for ( const char *c = begin; c != end; ++c )
+                    {
+                        ret.rows.push_back( static_cast<char_type>( static_cast<unsigned char>( *c ) ) );
+                    }
+
+                    ret.rows.append( ret.width - static_cast<size_type>( end - begin ), char_type( ' ' ) );
+                }
+
+                artlib_edges( ret.rows.data(), ret.width, height, ret.left, ret.right );
+
+                return ret;
+            }
+
+           public:
+            basic_anixt_unicode_font() = default;
+
+            /**
+             * @brief constructor
+             * @param capacity letters kept in cache
+             **/
+            explicit basic_anixt_unicode_font( size_type capacity )
+                : capacity( std::max<size_type>( capacity, 1 ) )
+            {
+            }
+
+            basic_anixt_unicode_font( const basic_anixt_unicode_font & ) = delete;
+            ~basic_anixt_unicode_font()                                  = default;
+
+            basic_anixt_unicode_font &operator=( const basic_anixt_unicode_font & ) = delete;
+
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept override
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+
+                this->cache.clear();
+                this->slots.clear();
+                this->index.clear();
+                this->offsets.clear();
+                this->mapping.reset();
+                this->size = 0;
+                this->config.clear();
+            }
+
+            /**
+             * @brief sets number of letters kept in cache
+             * @param count letters kept in cache
+             **/
+            void set_capacity( size_type count )
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+
+                this->capacity = std::max<size_type>( count, 1 );
+
+                if ( this->pins == 0 )
+                {
+                    this->trim( this->capacity );
+                }
+            }
+
+            /**
+             * @brief  number of letters in cache
+             * @return letters in cache
+             **/
+            size_type cached() const
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+                return this->cache.size();
+            }
+
+            /**
+             * @brief used to set font file, call this before
+             *        any other operation. file is mapped and only
+             *        position of letters is read.
+             * @param fp full path to flf font file
+             **/
+            void set_font( const std::filesystem::path &fp ) override
+            {
+                if ( fp.extension() != ".flf" )
+                {
+                    throw std::runtime_error( "File should be flf" );
+                }
+
+                std::size_t                      length = 0;
+                std::shared_ptr<const byte_type> data   = artlib_map_file( fp, length );
+                anixt_flf_scanner                scan( reinterpret_cast<const char *>( data.get() ), length );
+
+                this->clear();
+
+                try
+                {
+                    anixt_flf_scanner::header_type head = scan.header();
+
+                    this->config.HardBlank = static_cast<char_type>( static_cast<unsigned char>( head.hardblank ) );
+                    this->config.Height    = static_cast<size_type>( head.height );
+                    this->config.Shrink    = static_cast<shrink_type>( anixt_flf_scanner::shrink_level( head ) );
+                    this->config.Layout    = anixt_flf_scanner::full_layout( head );
+
+                    vector_type<const char *> lines( this->config.Height * 2 );
+
+                    scan.letters( [&]( long code ) {
+                        std::size_t offset = scan.tell();
+
+                        if ( scan.rows( this->config.Height, lines ) == std::string::npos )
+                        {
+                            return false;
+                        }
+
+                        if ( code >= 0 && static_cast<unsigned long>( code ) <= index_type::max_code )
+                        {
+                            std::uint32_t letter = this->index.find( static_cast<char32_t>( code ) );
+
+                            if ( letter == index_type::npos )
+                            {
+                                letter = static_cast<std::uint32_t>( this->offsets.size() );
+                                this->offsets.push_back( 0 );
+                                this->index.insert( static_cast<char32_t>( code ), letter );
+                            }
+
+                            this->offsets[letter] = offset;
+                        }
+
+                        return true;
+                    } );
+
+                    artlib_validate_config( this->config, shrink_type::level_2 );
+
+                    this->mapping = std::move( data );
+                    this->size    = length;
+                }
+                catch ( ... )
+                {
+                    this->clear();
+                    throw;
+                }
+            }
+
+            /**
+             * @brief  used to get anixt_config
+             * @return anixt_config
+             **/
+            anixt_config get_anixt_config() const override
+            {
+                return this->config;
+            }
+
+            /**
+             * @brief  tells font is validated at load, letters are
+             *         always decoded in to Height rows of equal width
+             * @return true if font is set
+             **/
+            bool validated() const noexcept override
+            {
+                return this->size != 0;
+            }
+
+            /**
+             * @brief used to get anixt_glyph from font
+             * @param key key letter
+             * @return anixt_glyph
+             **/
+            anixt_glyph operator()( char_type key ) const override
+            {
+                return this->get_anixt_glyph( static_cast<std::make_unsigned_t<char_type>>( key ) );
+            }
+
+            /**
+             * @brief used to get anixt_glyph of codepoint from font,
+             *        letter is decoded if it is not in cache
+             * @param code codepoint
+             * @return anixt_glyph
+             **/
+            anixt_glyph get_anixt_glyph( char32_t code ) const override
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+
+                std::uint32_t letter = this->index.find( code );
+
+                if ( letter == index_type::npos )
+                {
+                    throw std::runtime_error( "Letter not found in font" );
+                }
+
+                auto slot = this->slots.find( letter );
+
+                if ( slot != this->slots.end() )
+                {
+                    this->cache.splice( this->cache.begin(), this->cache, slot->second );
+                }
+                else
+                {
+                    entry decoded = this->decode( letter );
+
+                    if ( this->pins == 0 )
+                    {
+                        this->trim( this->capacity - 1 );
+                    }
+
+                    this->cache.push_front( std::move( decoded ) );
+                    this->slots.emplace( letter, this->cache.begin() );
+                }
+
+                const entry &ret = this->cache.front();
+
+                return anixt_glyph { ret.rows.data(), ret.width, this->config.Height,
+                                     ret.left.data(), ret.right.data(), code };
+            }
+
+            /**
+             * @brief pins glyphs taken from font
+             **/
+            void pin() const override
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+                ++this->pins;
+            }
+
+            /**
+             * @brief unpins glyphs, cache is trimmed to capacity
+             *        when no pin is held
+             **/
+            void unpin() const noexcept override
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+
+                if ( this->pins != 0 && --this->pins == 0 )
+                {
+                    this->trim( this->capacity );
+                }
+            }
+        };
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
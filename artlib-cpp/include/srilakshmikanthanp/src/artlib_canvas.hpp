@@ -0,0 +1,547 @@
+///@file artlib_canvas.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_CANVAS_HEADER
+#define ARTLIB_CANVAS_HEADER
+
+#include "algorithm"
+#include "cstddef"
+#include "iterator"
+#include "memory"
+#include "ostream"
+#include "string"
+#include "string_view"
+#include "utility"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @struct artlib_extent
+         * @brief  width and height of rendered art
+         * @tparam SizeT size_type
+         **/
+        template <typename SizeT>
+        struct artlib_extent
+        {
+            SizeT width;
+            SizeT height;
+        };
+
+        /**
+         * @class  artlib_canvas
+         * @brief  rows of art in one contiguous row major buffer,
+         *         row i starts at i * stride and has width chars,
+         *         stride may be larger than width so rows can grow
+         *         in place while rendering
+         * @tparam CharT  char_type
+         * @tparam Traits traits_type, defaults to std::char_traits<CharT>
+         * @tparam Alloc  alloc_type, defaults to std::allocator
+         **/
+        template <typename CharT,
+                  typename Traits                    = std::char_traits<CharT>,
+                  template <typename> typename Alloc = std::allocator>
+        class artlib_canvas
+        {
+           public:
+            using char_type        = CharT;
+            using traits_type      = Traits;
+            using size_type        = std::size_t;
+            using string_type      = std::basic_string<CharT, Traits, Alloc<CharT>>;
+            using string_view_type = std::basic_string_view<CharT, Traits>;
+            using value_type       = string_view_type;
+            using allocator_type   = Alloc<CharT>;
+
+            /**
+             * @class const_iterator
+             * @brief iterates rows of canvas as string_view_type
+             **/
+            class const_iterator
+            {
+               private:
+                const artlib_canvas *canvas { nullptr };
+                size_type            pos { 0 };
+
+               public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = string_view_type;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = void;
+                using reference         = string_view_type;
+
+                const_iterator() = default;
+
+                const_iterator( const artlib_canvas *canvas, size_type pos ) noexcept
+                    : canvas( canvas ), pos( pos )
+                {
+                }
+
+                reference operator*() const noexcept
+                {
+                    return this->canvas->row( this->pos );
+                }
+
+                reference operator[]( difference_type n ) const noexcept
+                {
+                    return this->canvas->row( this->pos + n );
+                }
+
+                const_iterator &operator++() noexcept
+                {
+                    ++this->pos;
+                    return *this;
+                }
+
+                const_iterator operator++( int ) noexcept
+                {
+                    const_iterator ret = *this;
+                    ++this->pos;
+                    return ret;
+                }
+
+                const_iterator &operator--() noexcept
+                {
+                    --this->pos;
+                    return *this;
+                }
+
+                const_iterator operator--( int ) noexcept
+                {
+                    const_iterator ret = *this;
+                    --this->pos;
+                    return ret;
+                }
+
+                const_iterator &operator+=( difference_type n ) noexcept
+                {
+                    this->pos += n;
+                    return *this;
+                }
+
+                const_iterator &operator-=( difference_type n ) noexcept
+                {
+                    this->pos -= n;
+                    return *this;
+                }
+
+                friend const_iterator operator+( const_iterator it, difference_type n ) noexcept
+                {
+                    return it += n;
+                }
+
+                friend const_iterator operator-( const_iterator it, difference_type n ) noexcept
+                {
+                    return it -= n;
+                }
+
+                friend difference_type operator-( const const_iterator &lhs, const const_iterator &rhs ) noexcept
+                {
+                    return difference_type( lhs.pos ) - difference_type( rhs.pos );
+                }
+
+                friend bool operator==( const const_iterator &lhs, const const_iterator &rhs ) noexcept
+                {
+                    return lhs.pos == rhs.pos;
+                }
+
+                friend bool operator!=( const const_iterator &lhs, const const_iterator &rhs ) noexcept
+                {
+                    return lhs.pos != rhs.pos;
+                }
+
+                friend bool operator<( const const_iterator &lhs, const const_iterator &rhs ) noexcept
+                {
+                    return lhs.pos < rhs.pos;
+                }
+            };
+
+            using iterator = const_iterator;
+
+           private:
+            /**
+             * @brief rows of canvas
+             **/
+            string_type buffer;
+
+            /**
+             * @brief width, height and stride of canvas
+             **/
+            size_type cols { 0 }, lines { 0 }, pitch { 0 };
+
+           public:
+            artlib_canvas()                            = default;
+            artlib_canvas( const artlib_canvas & )     = default;
+            artlib_canvas( artlib_canvas && ) noexcept = default;
+            ~artlib_canvas()                           = default;
+
+            artlib_canvas &operator=( const artlib_canvas & ) = default;
+            artlib_canvas &operator=( artlib_canvas && ) noexcept = default;
+
+            /**
+             * @brief constructor, buffer is allocated by alloc
+             * @param alloc allocator
+             **/
+            explicit artlib_canvas( const allocator_type &alloc )
+                : buffer( alloc )
+            {
+            }
+
+            /**
+             * @brief copy constructor, buffer is allocated by alloc
+             * @param obj object to copy
+             * @param alloc allocator
+             **/
+            artlib_canvas( const artlib_canvas &obj, const allocator_type &alloc )
+                : buffer( obj.buffer, alloc ),
+                  cols( obj.cols ),
+                  lines( obj.lines ),
+                  pitch( obj.pitch )
+            {
+            }
+
+            /**
+             * @brief move constructor, buffer is allocated by alloc
+             *        if obj has other allocator
+             * @param obj object to move
+             * @param alloc allocator
+             **/
+            artlib_canvas( artlib_canvas &&obj, const allocator_type &alloc )
+                : buffer( std::move( obj.buffer ), alloc ),
+                  cols( obj.cols ),
+                  lines( obj.lines ),
+                  pitch( obj.pitch )
+            {
+            }
+
+            /**
+             * @brief  allocator of buffer
+             * @return allocator
+             **/
+            allocator_type get_allocator() const noexcept
+            {
+                return this->buffer.get_allocator();
+            }
+
+            /**
+             * @brief constructor
+             * @param width width of rows
+             * @param height number of rows
+             * @param fill fill character
+             **/
+            artlib_canvas( size_type width, size_type height, char_type fill = char_type( ' ' ) )
+            {
+                this->assign( width, height, width, fill );
+            }
+
+            /**
+             * @brief converts rows of anixt_string, runeape_image
+             *        or any range of strings, rows are padded to
+             *        width of widest row
+             * @param obj rows
+             **/
+            template <typename Type, typename = decltype( std::declval<const Type &>().begin()->size() )>
+            explicit artlib_canvas( const Type &obj )
+            {
+                size_type width = 0, height = 0;
+
+                for ( const auto &i : obj )
+                {
+                    width = std::max<size_type>( width, i.size() );
+                    ++height;
+                }
+
+                this->assign( width, height, width, char_type( ' ' ) );
+
+                size_type r = 0;
+
+                for ( const auto &i : obj )
+                {
+                    std::copy( i.begin(), i.end(), this->row_data( r++ ) );
+                }
+            }
+
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept
+            {
+                this->buffer.clear();
+                this->cols  = 0;
+                this->lines = 0;
+                this->pitch = 0;
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( artlib_canvas &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->buffer, obj.buffer );
+                swap( this->cols, obj.cols );
+                swap( this->lines, obj.lines );
+                swap( this->pitch, obj.pitch );
+            }
+
+            /**
+             * @brief sets shape of canvas and fills it, buffer is
+             *        reused if it is large enough
+             * @param width width of rows
+             * @param height number of rows
+             * @param stride distance between rows, at least width
+             * @param fill fill character
+             **/
+            void assign( size_type width, size_type height, size_type stride, char_type fill = char_type( ' ' ) )
+            {
+                stride = std::max( stride, width );
+
+                this->buffer.assign( stride * height, fill );
+                this->cols  = width;
+                this->lines = height;
+                this->pitch = stride;
+            }
+
+            /**
+             * @brief sets width of rows, rows keep their place
+             * @param width width of rows, at most stride
+             **/
+            void set_width( size_type width ) noexcept
+            {
+                this->cols = std::min( width, this->pitch );
+            }
+
+            /**
+             * @brief  width of rows
+             * @return width
+             **/
+            size_type width() const noexcept
+            {
+                return this->cols;
+            }
+
+            /**
+             * @brief  number of rows
+             * @return height
+             **/
+            size_type height() const noexcept
+            {
+                return this->lines;
+            }
+
+            /**
+             * @brief  distance between begin of rows
+             * @return stride
+             **/
+            size_type stride() const noexcept
+            {
+                return this->pitch;
+            }
+
+            /**
+             * @brief  number of rows
+             * @return height
+             **/
+            size_type size() const noexcept
+            {
+                return this->lines;
+            }
+
+            /**
+             * @brief  checks canvas has no rows
+             * @return true if empty
+             **/
+            bool empty() const noexcept
+            {
+                return this->lines == 0;
+            }
+
+            /**
+             * @brief  buffer of canvas
+             * @return pointer to first row
+             **/
+            char_type *data() noexcept
+            {
+                return &this->buffer[0];
+            }
+
+            /**
+             * @brief  buffer of canvas
+             * @return pointer to first row
+             **/
+            const char_type *data() const noexcept
+            {
+                return this->buffer.data();
+            }
+
+            /**
+             * @brief  begin of row
+             * @param  i index of row
+             * @return pointer to row
+             **/
+            char_type *row_data( size_type i ) noexcept
+            {
+                return this->data() + i * this->pitch;
+            }
+
+            /**
+             * @brief  begin of row
+             * @param  i index of row
+             * @return pointer to row
+             **/
+            const char_type *row_data( size_type i ) const noexcept
+            {
+                return this->data() + i * this->pitch;
+            }
+
+            /**
+             * @brief  row of canvas
+             * @param  i index of row
+             * @return view of row
+             **/
+            string_view_type row( size_type i ) const noexcept
+            {
+                return string_view_type( this->row_data( i ), this->cols );
+            }
+
+            /**
+             * @brief  row of canvas
+             * @param  i index of row
+             * @return view of row
+             **/
+            string_view_type operator[]( size_type i ) const noexcept
+            {
+                return this->row( i );
+            }
+
+            /**
+             * @brief  iterator to first row
+             * @return iterator
+             **/
+            const_iterator begin() const noexcept
+            {
+                return const_iterator( this, 0 );
+            }
+
+            /**
+             * @brief  iterator past last row
+             * @return iterator
+             **/
+            const_iterator end() const noexcept
+            {
+                return const_iterator( this, this->lines );
+            }
+
+            /**
+             * @brief  converts canvas to anixt_string or runeape_image,
+             *         kept for compatibility
+             * @return rows as Type
+             **/
+            template <typename Type>
+            Type to() const
+            {
+                Type ret;
+
+                this->to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief copies rows in to anixt_string or runeape_image,
+             *        rows and their buffers are reused so copy in a
+             *        loop does not allocate once they are large enough
+             * @param ret rows as Type
+             **/
+            template <typename Type>
+            void to( Type &ret ) const
+            {
+                ret.resize( this->lines );
+
+                for ( size_type i = 0; i < this->lines; i++ )
+                {
+                    const string_view_type row = this->row( i );
+
+                    ret[i].assign( row.begin(), row.end() );
+                }
+            }
+
+            /**
+             * @brief copies rows in to ret, rows that ret does not
+             *        need are moved to spare and taken back from it
+             *        so buffers of rows are kept when height changes
+             * @param ret rows as Type
+             * @param spare rows kept for next copy
+             **/
+            template <typename Type, typename Spare>
+            void to( Type &ret, Spare &spare ) const
+            {
+                size_type kept = std::min<size_type>( ret.size(), this->lines );
+
+                for ( size_type i = static_cast<size_type>( ret.size() ); i > kept; i-- )
+                {
+                    spare.push_back( std::move( ret[i - 1] ) );
+                }
+
+                ret.resize( this->lines );
+
+                for ( size_type i = kept; i < this->lines && !spare.empty(); i++ )
+                {
+                    ret[i] = std::move( spare.back() );
+                    spare.pop_back();
+                }
+
+                this->to( ret );
+            }
+
+            /**
+             * @brief prints canvas to stream
+             * @param stream outputstream
+             * @param canvas canvas object
+             * @return reference to stream
+             **/
+            friend std::basic_ostream<CharT, Traits> &
+            operator<<( std::basic_ostream<CharT, Traits> &stream,
+                        const artlib_canvas &               canvas )
+            {
+                stream << std::endl;
+                for ( const auto &str : canvas )
+                {
+                    stream << str << std::endl;
+                }
+                return stream;
+            }
+        };
+
+        /**
+         * @brief swap two artlib_canvas
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename CharT, typename Traits, template <typename> typename Alloc>
+        void swap( artlib_canvas<CharT, Traits, Alloc> &lhs,
+                   artlib_canvas<CharT, Traits, Alloc> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
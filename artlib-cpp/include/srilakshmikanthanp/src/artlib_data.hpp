@@ -1,6 +1,9 @@
 #ifndef STRVEC
 #define STRVEC
 
+#include "artlib_simd.hpp"
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -80,6 +83,106 @@ namespace srilakshmikanthanp
             }
         };
 
+        /**
+         * @brief  finds edges of rows and appends them, left edge
+         *         is count of spaces before first ink and right
+         *         edge is count of spaces after last ink, both
+         *         are width if row is blank
+         * @param  rows rows of width one after other
+         * @param  width width of rows
+         * @param  height number of rows
+         * @param  left left edges
+         * @param  right right edges
+         **/
+        template <typename Char, typename Sizes>
+        void artlib_edges( const Char *rows, typename Sizes::value_type width,
+                           typename Sizes::value_type height, Sizes &left, Sizes &right )
+        {
+            using size_type = typename Sizes::value_type;
+
+            for ( size_type i = 0; i < height; i++, rows += width )
+            {
+                size_type l = static_cast<size_type>( artlib_span( rows, width, Char( ' ' ) ) );
+
+                left.push_back( l );
+                right.push_back( l == width ? width : static_cast<size_type>( artlib_rspan( rows, width, Char( ' ' ) ) ) );
+            }
+        }
+
+        /**
+         * @brief  validates config of font or gallery once at load,
+         *         Height should not be 0, HardBlank should not be
+         *         space or line break and Shrink should be known
+         * @param  config anixt_config or runeape_config
+         * @param  max_shrink highest Shrink level
+         **/
+        template <typename Config>
+        void artlib_validate_config( const Config &config, typename Config::shrink max_shrink )
+        {
+            using char_type = typename Config::char_type;
+
+            if ( config.Height == 0 )
+            {
+                throw std::runtime_error( "Height is not valid" );
+            }
+
+            if ( config.HardBlank == char_type( ' ' ) || config.HardBlank == char_type( '\n' ) ||
+                 config.HardBlank == char_type( '\r' ) )
+            {
+                throw std::runtime_error( "HardBlank is not valid" );
+            }
+
+            if ( static_cast<std::size_t>( config.Shrink ) > static_cast<std::size_t>( max_shrink ) )
+            {
+                throw std::runtime_error( "Shrink is not valid" );
+            }
+        }
+
+        /**
+         * @brief highest FIGlet full layout, bits 0 to 14
+         **/
+        constexpr long artlib_max_layout = 32767;
+
+        /**
+         * @brief  validates FIGlet full layout of font, -1 is
+         *         font without layout
+         * @param  layout layout of font
+         **/
+        inline void artlib_validate_layout( long layout )
+        {
+            if ( layout < -1 || layout > artlib_max_layout )
+            {
+                throw std::runtime_error( "Layout is not valid" );
+            }
+        }
+
+        /**
+         * @brief  validates rows of letter or image once at load,
+         *         height rows of width should be inside storage
+         *         and should not have line break
+         * @param  rows storage of rows
+         * @param  count size of storage
+         * @param  offset offset of rows in storage
+         * @param  width width of rows
+         * @param  height number of rows
+         **/
+        template <typename Char, typename SizeT>
+        void artlib_validate_rows( const Char *rows, SizeT count, SizeT offset, SizeT width, SizeT height )
+        {
+            if ( offset > count || ( width != 0 && height > ( count - offset ) / width ) )
+            {
+                throw std::runtime_error( "Rows are out of storage" );
+            }
+
+            for ( const Char *c = rows + offset, *end = c + width * height; c != end; ++c )
+            {
+                if ( *c == Char( '\n' ) || *c == Char( '\r' ) )
+                {
+                    throw std::runtime_error( "Rows have line break" );
+                }
+            }
+        }
+
     } // namespace art
 
 } // namespace srilakshmikanthanp
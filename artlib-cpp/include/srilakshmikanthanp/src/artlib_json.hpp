@@ -0,0 +1,330 @@
+///@file artlib_json.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_JSON_HEADER
+#define ARTLIB_JSON_HEADER
+
+#include "algorithm"
+#include "cstddef"
+#include "limits"
+#include "stdexcept"
+#include "string"
+#include "third_party/json/json.hpp"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  artlib_json_sax
+         * @brief  sax handler for font and gallery files, streams
+         *         the config and the rows of each item to Sink
+         *         without building json tree.
+         *
+         *         file is an object of config section, an object
+         *         of numbers, and data section, an object of arrays
+         *         of strings. other values are skipped.
+         *
+         *         Sink should have
+         *         config( key, value ), begin( name ), row( str ),
+         *         end(). value of config is long long, Sink checks
+         *         the sign as it knows the key
+         * @tparam Json basic_json type
+         * @tparam Sink receiver type
+         **/
+        template <typename Json, typename Sink>
+        class artlib_json_sax
+        {
+           public:
+            using number_integer_t  = typename Json::number_integer_t;
+            using number_unsigned_t = typename Json::number_unsigned_t;
+            using number_float_t    = typename Json::number_float_t;
+            using string_t          = typename Json::string_t;
+            using binary_t          = typename Json::binary_t;
+
+           private:
+            enum class section
+            {
+                skip,
+                config,
+                data
+            };
+
+            Sink &         sink;
+            const string_t config_name;
+            const string_t data_name;
+            string_t       name {};
+            section        current { section::skip };
+            std::size_t    depth { 0 };
+            bool           in_item { false };
+            std::string    error {};
+
+           public:
+            /**
+             * @brief constructor
+             * @param sink receiver
+             * @param config_name name of config section
+             * @param data_name name of data section
+             **/
+            artlib_json_sax( Sink &sink, string_t config_name, string_t data_name )
+                : sink( sink ),
+                  config_name( std::move( config_name ) ),
+                  data_name( std::move( data_name ) )
+            {
+            }
+
+            /**
+             * @brief  parses input with this handler
+             * @param  input input stream
+             **/
+            template <typename Input>
+            void parse( Input &&input )
+            {
+                if ( !Json::sax_parse( std::forward<Input>( input ), this ) )
+                {
+                    throw std::runtime_error( this->error.empty() ? "Invalid json file" : this->error );
+                }
+            }
+
+            bool null()
+            {
+                return true;
+            }
+
+            bool boolean( bool )
+            {
+                return true;
+            }
+
+            bool number_integer( number_integer_t val )
+            {
+                if ( this->depth == 2 && this->current == section::config )
+                {
+                    this->sink.config( this->name, static_cast<long long>( val ) );
+                }
+
+                return true;
+            }
+
+            bool number_unsigned( number_unsigned_t val )
+            {
+                // numbers past long long are too large for any key
+                constexpr number_unsigned_t max = std::numeric_limits<long long>::max();
+
+                return this->number_integer( static_cast<number_integer_t>( std::min( val, max ) ) );
+            }
+
+            // text of number is std::string in binary readers of
+            // json whatever string_t is
+            template <typename String>
+            bool number_float( number_float_t, const String & )
+            {
+                return true;
+            }
+
+            bool string( string_t &val )
+            {
+                if ( this->in_item && this->depth == 3 )
+                {
+                    this->sink.row( val );
+                }
+
+                return true;
+            }
+
+            bool binary( binary_t & )
+            {
+                return true;
+            }
+
+            bool start_object( std::size_t )
+            {
+                ++this->depth;
+                return true;
+            }
+
+            bool end_object()
+            {
+                --this->depth;
+                return true;
+            }
+
+            bool key( string_t &val )
+            {
+                if ( this->depth == 1 )
+                {
+                    this->current = val == this->config_name ? section::config
+                                    : val == this->data_name ? section::data
+                                                             : section::skip;
+                }
+                else if ( this->depth == 2 )
+                {
+                    this->name = val;
+                }
+
+                return true;
+            }
+
+            bool start_array( std::size_t )
+            {
+                if ( ++this->depth == 3 && this->current == section::data )
+                {
+                    this->in_item = true;
+                    this->sink.begin( this->name );
+                }
+
+                return true;
+            }
+
+            bool end_array()
+            {
+                if ( this->depth-- == 3 && this->in_item )
+                {
+                    this->in_item = false;
+                    this->sink.end();
+                }
+
+                return true;
+            }
+
+            template <typename Exception>
+            bool parse_error( std::size_t, const std::string &, const Exception &ex )
+            {
+                this->error = ex.what();
+                return false;
+            }
+        };
+
+        /**
+         * @class  artlib_json_rows
+         * @brief  packs rows of items one after other in one
+         *         string, rows of an item are padded to width
+         *         of its widest row
+         * @tparam String string_type
+         * @tparam Sizes vector of size_type
+         **/
+        template <typename String, typename Sizes>
+        class artlib_json_rows
+        {
+           public:
+            using size_type = typename Sizes::value_type;
+
+           private:
+            String &  rows;
+            Sizes     widths {};
+            size_type start { 0 };
+
+           public:
+            /**
+             * @brief constructor
+             * @param rows string to pack in
+             **/
+            explicit artlib_json_rows( String &rows )
+                : rows( rows )
+            {
+            }
+
+            /**
+             * @brief starts new item
+             **/
+            void begin()
+            {
+                this->start = this->rows.size();
+                this->widths.clear();
+            }
+
+            /**
+             * @brief appends row of item
+             * @param str row
+             **/
+            void row( const String &str )
+            {
+                this->rows += str;
+                this->widths.push_back( str.size() );
+            }
+
+            /**
+             * @brief  ends item, pads rows if they are not equal
+             * @return width of item
+             **/
+            size_type end()
+            {
+                size_type width = 0;
+
+                for ( auto w : this->widths )
+                {
+                    width = std::max( width, w );
+                }
+
+                for ( auto w : this->widths )
+                {
+                    if ( w != width )
+                    {
+                        this->justify( width );
+                        break;
+                    }
+                }
+
+                return width;
+            }
+
+            /**
+             * @brief  offset of current item
+             * @return offset
+             **/
+            size_type offset() const noexcept
+            {
+                return this->start;
+            }
+
+            /**
+             * @brief  number of rows in current item
+             * @return count
+             **/
+            size_type count() const noexcept
+            {
+                return this->widths.size();
+            }
+
+           private:
+            /**
+             * @brief pads rows of current item to width
+             * @param width width
+             **/
+            void justify( size_type width )
+            {
+                String    packed( this->rows.get_allocator() );
+                size_type pos = this->start;
+
+                packed.reserve( width * this->widths.size() );
+
+                for ( auto w : this->widths )
+                {
+                    packed.append( this->rows, pos, w );
+                    packed.append( width - w, ' ' );
+                    pos += w;
+                }
+
+                this->rows.replace( this->start, String::npos, packed );
+            }
+        };
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
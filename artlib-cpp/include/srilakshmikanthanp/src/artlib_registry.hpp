@@ -0,0 +1,165 @@
+///@file artlib_registry.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_REGISTRY_HEADER
+#define ARTLIB_REGISTRY_HEADER
+
+#include "filesystem"
+#include "map"
+#include "memory"
+#include "mutex"
+#include "system_error"
+#include "utility"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  artlib_registry
+         * @brief  process wide registry of loaded fonts or
+         *         galleries, same file is loaded once and
+         *         shared as long as any one holds it.
+         * @tparam Type font_type or gallery_type
+         **/
+        template <typename Type>
+        class artlib_registry
+        {
+           public:
+            using value_type = Type;
+
+           private:
+            using key_type = std::pair<std::filesystem::path, std::filesystem::file_time_type>;
+
+            /**
+             * @brief guards entries
+             **/
+            std::mutex mutex;
+
+            /**
+             * @brief loaded files, keyed by canonical path and
+             *        modification time
+             **/
+            std::map<key_type, std::weak_ptr<const Type>> entries;
+
+            artlib_registry() = default;
+
+            /**
+             * @brief removes entries no one holds
+             **/
+            void sweep()
+            {
+                for ( auto it = this->entries.begin(); it != this->entries.end(); )
+                {
+                    it = it->second.expired() ? this->entries.erase( it ) : std::next( it );
+                }
+            }
+
+           public:
+            artlib_registry( const artlib_registry & ) = delete;
+            artlib_registry &operator=( const artlib_registry & ) = delete;
+
+            /**
+             * @brief  returns registry of Type
+             * @return registry
+             **/
+            static artlib_registry &instance()
+            {
+                static artlib_registry registry;
+                return registry;
+            }
+
+            /**
+             * @brief  returns shared object of file, loads it
+             *         with load if not loaded or file is modified
+             * @param  fp full path to file
+             * @param  load callable as load( Type &, fp )
+             * @return shared object
+             **/
+            template <typename Load>
+            std::shared_ptr<const Type> acquire( const std::filesystem::path &fp, Load load )
+            {
+                std::error_code ec;
+                key_type        key { std::filesystem::canonical( fp, ec ), {} };
+
+                if ( !ec )
+                {
+                    key.second = std::filesystem::last_write_time( key.first, ec );
+                }
+
+                // file that can not be found is not shared, load
+                // reports it as font or gallery does
+                if ( ec )
+                {
+                    auto obj = std::make_shared<Type>();
+                    load( *obj, fp );
+                    return obj;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock( this->mutex );
+
+                    auto it = this->entries.find( key );
+
+                    if ( it != this->entries.end() )
+                    {
+                        if ( auto ptr = it->second.lock() )
+                        {
+                            return ptr;
+                        }
+                    }
+                }
+
+                auto obj = std::make_shared<Type>();
+                load( *obj, fp );
+
+                std::lock_guard<std::mutex> lock( this->mutex );
+
+                auto it = this->entries.find( key );
+
+                // other thread may have loaded it meanwhile
+                if ( it != this->entries.end() )
+                {
+                    if ( auto ptr = it->second.lock() )
+                    {
+                        return ptr;
+                    }
+                }
+
+                this->sweep();
+                this->entries[key] = obj;
+
+                return obj;
+            }
+
+            /**
+             * @brief  returns number of loaded files
+             * @return count
+             **/
+            std::size_t size()
+            {
+                std::lock_guard<std::mutex> lock( this->mutex );
+                this->sweep();
+                return this->entries.size();
+            }
+        };
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
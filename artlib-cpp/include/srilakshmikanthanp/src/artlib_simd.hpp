@@ -0,0 +1,380 @@
+///@file artlib_simd.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_SIMD_HEADER
+#define ARTLIB_SIMD_HEADER
+
+#include "algorithm"
+#include "cstddef"
+#include "type_traits"
+
+#if !defined( ARTLIB_NO_SIMD ) && defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include "immintrin.h"
+#define ARTLIB_HAS_SIMD
+#endif
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @struct artlib_simd_kernels
+         * @brief  byte kernels of scans in rows, picked once for
+         *         the cpu at first use
+         **/
+        struct artlib_simd_kernels
+        {
+            using byte_type = unsigned char;
+
+            /**
+             * @brief copies n bytes of src to dst with from replaced
+             *        by to, src and dst are same or do not overlap
+             **/
+            void ( *replace_copy )( const byte_type *src, std::size_t n, byte_type *dst,
+                                    byte_type from, byte_type to ) noexcept;
+
+            /**
+             * @brief count of leading bytes of n bytes that are ch
+             **/
+            std::size_t ( *span )( const byte_type *src, std::size_t n, byte_type ch ) noexcept;
+
+            /**
+             * @brief count of trailing bytes of n bytes that are ch
+             **/
+            std::size_t ( *rspan )( const byte_type *src, std::size_t n, byte_type ch ) noexcept;
+        };
+
+        /**
+         * @namespace artlib_simd_detail
+         * @brief     scalar and vector kernels
+         **/
+        namespace artlib_simd_detail
+        {
+            using byte_type = unsigned char;
+
+            /**
+             * @brief rows shorter than this are scanned in line,
+             *        they are too short for vector kernels
+             **/
+            constexpr std::size_t threshold = 16;
+
+            /**
+             * @brief scalar kernels, also used for tails of rows
+             **/
+            inline void replace_copy_scalar( const byte_type *src, std::size_t n, byte_type *dst,
+                                             byte_type from, byte_type to ) noexcept
+            {
+                for ( std::size_t i = 0; i < n; i++ )
+                {
+                    dst[i] = src[i] == from ? to : src[i];
+                }
+            }
+
+            inline std::size_t span_scalar( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                std::size_t i = 0;
+
+                while ( i < n && src[i] == ch )
+                {
+                    ++i;
+                }
+
+                return i;
+            }
+
+            inline std::size_t rspan_scalar( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                std::size_t i = 0;
+
+                while ( i < n && src[n - i - 1] == ch )
+                {
+                    ++i;
+                }
+
+                return i;
+            }
+
+#ifdef ARTLIB_HAS_SIMD
+            /**
+             * @brief SSE2 kernels, 16 bytes at a time
+             **/
+            __attribute__( ( target( "sse2" ) ) ) inline void
+            replace_copy_sse2( const byte_type *src, std::size_t n, byte_type *dst, byte_type from, byte_type to ) noexcept
+            {
+                const __m128i f = _mm_set1_epi8( static_cast<char>( from ) );
+                const __m128i t = _mm_set1_epi8( static_cast<char>( to ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 16 <= n; i += 16 )
+                {
+                    __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i *>( src + i ) );
+                    __m128i m = _mm_cmpeq_epi8( v, f );
+
+                    _mm_storeu_si128( reinterpret_cast<__m128i *>( dst + i ),
+                                      _mm_or_si128( _mm_andnot_si128( m, v ), _mm_and_si128( m, t ) ) );
+                }
+
+                replace_copy_scalar( src + i, n - i, dst + i, from, to );
+            }
+
+            __attribute__( ( target( "sse2" ) ) ) inline std::size_t
+            span_sse2( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                const __m128i c = _mm_set1_epi8( static_cast<char>( ch ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 16 <= n; i += 16 )
+                {
+                    __m128i  v = _mm_loadu_si128( reinterpret_cast<const __m128i *>( src + i ) );
+                    unsigned m = ~static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpeq_epi8( v, c ) ) ) & 0xFFFFu;
+
+                    if ( m != 0 )
+                    {
+                        return i + static_cast<std::size_t>( __builtin_ctz( m ) );
+                    }
+                }
+
+                return i + span_scalar( src + i, n - i, ch );
+            }
+
+            __attribute__( ( target( "sse2" ) ) ) inline std::size_t
+            rspan_sse2( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                const __m128i c = _mm_set1_epi8( static_cast<char>( ch ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 16 <= n; i += 16 )
+                {
+                    __m128i  v = _mm_loadu_si128( reinterpret_cast<const __m128i *>( src + n - i - 16 ) );
+                    unsigned m = ~static_cast<unsigned>( _mm_movemask_epi8( _mm_cmpeq_epi8( v, c ) ) ) & 0xFFFFu;
+
+                    if ( m != 0 )
+                    {
+                        return i + static_cast<std::size_t>( __builtin_clz( m ) ) - 16;
+                    }
+                }
+
+                return i + rspan_scalar( src, n - i, ch );
+            }
+
+            /**
+             * @brief AVX2 kernels, 32 bytes at a time
+             **/
+            __attribute__( ( target( "avx2" ) ) ) inline void
+            replace_copy_avx2( const byte_type *src, std::size_t n, byte_type *dst, byte_type from, byte_type to ) noexcept
+            {
+                const __m256i f = _mm256_set1_epi8( static_cast<char>( from ) );
+                const __m256i t = _mm256_set1_epi8( static_cast<char>( to ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 32 <= n; i += 32 )
+                {
+                    __m256i v = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( src + i ) );
+                    __m256i m = _mm256_cmpeq_epi8( v, f );
+
+                    _mm256_storeu_si256( reinterpret_cast<__m256i *>( dst + i ), _mm256_blendv_epi8( v, t, m ) );
+                }
+
+                replace_copy_sse2( src + i, n - i, dst + i, from, to );
+            }
+
+            __attribute__( ( target( "avx2" ) ) ) inline std::size_t
+            span_avx2( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                const __m256i c = _mm256_set1_epi8( static_cast<char>( ch ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 32 <= n; i += 32 )
+                {
+                    __m256i  v = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( src + i ) );
+                    unsigned m = ~static_cast<unsigned>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, c ) ) );
+
+                    if ( m != 0 )
+                    {
+                        return i + static_cast<std::size_t>( __builtin_ctz( m ) );
+                    }
+                }
+
+                return i + span_sse2( src + i, n - i, ch );
+            }
+
+            __attribute__( ( target( "avx2" ) ) ) inline std::size_t
+            rspan_avx2( const byte_type *src, std::size_t n, byte_type ch ) noexcept
+            {
+                const __m256i c = _mm256_set1_epi8( static_cast<char>( ch ) );
+                std::size_t   i = 0;
+
+                for ( ; i + 32 <= n; i += 32 )
+                {
+                    __m256i  v = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( src + n - i - 32 ) );
+                    unsigned m = ~static_cast<unsigned>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, c ) ) );
+
+                    if ( m != 0 )
+                    {
+                        return i + static_cast<std::size_t>( __builtin_clz( m ) );
+                    }
+                }
+
+                return i + rspan_sse2( src, n - i, ch );
+            }
+#endif
+
+            /**
+             * @brief  picks kernels for the cpu
+             * @return artlib_simd_kernels
+             **/
+            inline artlib_simd_kernels select() noexcept
+            {
+#ifdef ARTLIB_HAS_SIMD
+                __builtin_cpu_init();
+
+                if ( __builtin_cpu_supports( "avx2" ) )
+                {
+                    return artlib_simd_kernels { replace_copy_avx2, span_avx2, rspan_avx2 };
+                }
+
+                if ( __builtin_cpu_supports( "sse2" ) )
+                {
+                    return artlib_simd_kernels { replace_copy_sse2, span_sse2, rspan_sse2 };
+                }
+#endif
+                return artlib_simd_kernels { replace_copy_scalar, span_scalar, rspan_scalar };
+            }
+
+            /**
+             * @brief true if Char is scanned as bytes
+             **/
+            template <typename Char>
+            constexpr bool is_byte = sizeof( Char ) == 1 && std::is_integral<Char>::value;
+        } // namespace artlib_simd_detail
+
+        /**
+         * @brief  kernels picked for the cpu, SSE2 or AVX2 where
+         *         the cpu has them and scalar otherwise
+         * @return artlib_simd_kernels
+         **/
+        inline const artlib_simd_kernels &artlib_simd() noexcept
+        {
+            static const artlib_simd_kernels kernels = artlib_simd_detail::select();
+            return kernels;
+        }
+
+        /**
+         * @brief  copies [first, last) to out with from replaced by
+         *         to, ranges are same or do not overlap
+         * @param  first begin of source
+         * @param  last end of source
+         * @param  out begin of destination
+         * @param  from character to replace
+         * @param  to replacement
+         * @return end of destination
+         **/
+        template <typename Char>
+        Char *artlib_replace_copy( const Char *first, const Char *last, Char *out, Char from, Char to ) noexcept
+        {
+            std::size_t n = static_cast<std::size_t>( last - first );
+
+            if constexpr ( artlib_simd_detail::is_byte<Char> )
+            {
+                if ( n >= artlib_simd_detail::threshold )
+                {
+                    artlib_simd().replace_copy( reinterpret_cast<const unsigned char *>( first ), n,
+                                                reinterpret_cast<unsigned char *>( out ),
+                                                static_cast<unsigned char>( from ), static_cast<unsigned char>( to ) );
+                    return out + n;
+                }
+            }
+
+            return std::replace_copy( first, last, out, from, to );
+        }
+
+        /**
+         * @brief replaces from by to in [first, last)
+         * @param first begin of range
+         * @param last end of range
+         * @param from character to replace
+         * @param to replacement
+         **/
+        template <typename Char>
+        void artlib_replace( Char *first, Char *last, Char from, Char to ) noexcept
+        {
+            artlib_replace_copy( static_cast<const Char *>( first ), static_cast<const Char *>( last ), first, from, to );
+        }
+
+        /**
+         * @brief  count of leading characters of row that are ch
+         * @param  row begin of row
+         * @param  n length of row
+         * @param  ch character
+         * @return count
+         **/
+        template <typename Char>
+        std::size_t artlib_span( const Char *row, std::size_t n, Char ch ) noexcept
+        {
+            if constexpr ( artlib_simd_detail::is_byte<Char> )
+            {
+                if ( n >= artlib_simd_detail::threshold )
+                {
+                    return artlib_simd().span( reinterpret_cast<const unsigned char *>( row ), n,
+                                               static_cast<unsigned char>( ch ) );
+                }
+            }
+
+            std::size_t i = 0;
+
+            while ( i < n && row[i] == ch )
+            {
+                ++i;
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief  count of trailing characters of row that are ch
+         * @param  row begin of row
+         * @param  n length of row
+         * @param  ch character
+         * @return count
+         **/
+        template <typename Char>
+        std::size_t artlib_rspan( const Char *row, std::size_t n, Char ch ) noexcept
+        {
+            if constexpr ( artlib_simd_detail::is_byte<Char> )
+            {
+                if ( n >= artlib_simd_detail::threshold )
+                {
+                    return artlib_simd().rspan( reinterpret_cast<const unsigned char *>( row ), n,
+                                                static_cast<unsigned char>( ch ) );
+                }
+            }
+
+            std::size_t i = 0;
+
+            while ( i < n && row[n - i - 1] == ch )
+            {
+                ++i;
+            }
+
+            return i;
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -0,0 +1,255 @@
+///@file artlib_sink.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_SINK_HEADER
+#define ARTLIB_SINK_HEADER
+
+#include "cstddef"
+#include "cstdio"
+#include "ostream"
+#include "stdexcept"
+#include "string"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include "cerrno"
+#include "sys/uio.h"
+#include "unistd.h"
+#define ARTLIB_HAS_WRITEV
+#endif
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @class  artlib_ostream_sink
+         * @brief  sink that writes segments to output stream as
+         *         they are appended, stream is not flushed
+         * @tparam CharT char_type
+         * @tparam Traits traits_type
+         **/
+        template <typename CharT, typename Traits = std::char_traits<CharT>>
+        class artlib_ostream_sink
+        {
+           public:
+            using char_type   = CharT;
+            using traits_type = Traits;
+            using stream_type = std::basic_ostream<CharT, Traits>;
+
+           private:
+            stream_type *stream;
+
+           public:
+            /**
+             * @brief constructor
+             * @param stream output stream, it should live longer
+             *        than sink
+             **/
+            explicit artlib_ostream_sink( stream_type &stream ) noexcept
+                : stream( &stream )
+            {
+            }
+
+            /**
+             * @brief writes segment to stream
+             * @param data begin of segment
+             * @param count number of characters
+             **/
+            void append( const char_type *data, std::size_t count )
+            {
+                this->stream->write( data, static_cast<std::streamsize>( count ) );
+            }
+
+            /**
+             * @brief segments are written on append, errors are
+             *        kept in state of stream
+             **/
+            void flush() noexcept
+            {
+            }
+        };
+
+        /**
+         * @class  artlib_file_sink
+         * @brief  sink that writes segments to FILE by fwrite as
+         *         they are appended, FILE is not flushed
+         * @tparam CharT char_type
+         **/
+        template <typename CharT = char>
+        class artlib_file_sink
+        {
+           public:
+            using char_type = CharT;
+
+           private:
+            std::FILE *file;
+
+           public:
+            /**
+             * @brief constructor
+             * @param file FILE opened for writing, it is not closed
+             **/
+            explicit artlib_file_sink( std::FILE *file ) noexcept
+                : file( file )
+            {
+            }
+
+            /**
+             * @brief writes segment to file
+             * @param data begin of segment
+             * @param count number of characters
+             **/
+            void append( const char_type *data, std::size_t count )
+            {
+                if ( std::fwrite( data, sizeof( char_type ), count, this->file ) != count )
+                {
+                    throw std::runtime_error( "Unable to write file" );
+                }
+            }
+
+            /**
+             * @brief segments are written on append
+             **/
+            void flush() noexcept
+            {
+            }
+        };
+
+#ifdef ARTLIB_HAS_WRITEV
+        /**
+         * @class  artlib_fd_sink
+         * @brief  sink that gathers segments without copying them
+         *         and writes them to file descriptor by writev when
+         *         Count segments are gathered or on flush, segments
+         *         that follow each other in memory are joined
+         * @tparam CharT char_type
+         * @tparam Count number of segments written by one writev
+         **/
+        template <typename CharT = char, std::size_t Count = 64>
+        class artlib_fd_sink
+        {
+           public:
+            using char_type = CharT;
+
+           private:
+            int          fd;
+            std::size_t  used { 0 };
+            struct iovec segments[Count];
+
+           public:
+            /**
+             * @brief constructor
+             * @param fd file descriptor opened for writing, it is
+             *        not closed
+             **/
+            explicit artlib_fd_sink( int fd ) noexcept
+                : fd( fd )
+            {
+            }
+
+            /**
+             * @brief copy constructor[deleted]
+             **/
+            artlib_fd_sink( const artlib_fd_sink & ) = delete;
+
+            /**
+             * @brief copy assignment[deleted]
+             **/
+            artlib_fd_sink &operator=( const artlib_fd_sink & ) = delete;
+
+            /**
+             * @brief gathers segment, it is written by next flush
+             * @param data begin of segment
+             * @param count number of characters
+             **/
+            void append( const char_type *data, std::size_t count )
+            {
+                std::size_t size = count * sizeof( char_type );
+
+                if ( size == 0 )
+                {
+                    return;
+                }
+
+                if ( this->used != 0 )
+                {
+                    struct iovec &last = this->segments[this->used - 1];
+
+                    if ( static_cast<const char *>( last.iov_base ) + last.iov_len == reinterpret_cast<const char *>( data ) )
+                    {
+                        last.iov_len += size;
+                        return;
+                    }
+                }
+
+                if ( this->used == Count )
+                {
+                    this->flush();
+                }
+
+                this->segments[this->used].iov_base = const_cast<char_type *>( data );
+                this->segments[this->used].iov_len  = size;
+                this->used++;
+            }
+
+            /**
+             * @brief writes gathered segments, partial writes are
+             *        continued and interrupted writes are retried
+             **/
+            void flush()
+            {
+                struct iovec *it   = this->segments;
+                std::size_t   left = this->used;
+
+                this->used = 0;
+
+                while ( left != 0 )
+                {
+                    ssize_t done = ::writev( this->fd, it, static_cast<int>( left ) );
+
+                    if ( done < 0 && errno == EINTR )
+                    {
+                        continue;
+                    }
+
+                    if ( done < 0 )
+                    {
+                        throw std::runtime_error( "Unable to write file descriptor" );
+                    }
+
+                    std::size_t size = static_cast<std::size_t>( done );
+
+                    for ( ; left != 0 && size >= it->iov_len; ++it, --left )
+                    {
+                        size -= it->iov_len;
+                    }
+
+                    if ( left != 0 )
+                    {
+                        it->iov_base = static_cast<char *>( it->iov_base ) + size;
+                        it->iov_len -= size;
+                    }
+                }
+            }
+        };
+#endif
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
@@ -0,0 +1,227 @@
+///@file artlib_unicode.hpp
+
+/**
+ * Copyright (c) 2020 Sri Lakshmi Kanthan P
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#ifndef ARTLIB_UNICODE_HEADER
+#define ARTLIB_UNICODE_HEADER
+
+#include "memory"
+#include "type_traits"
+#include "vector"
+
+/**
+ * @namespace srilakshmikanthanp
+ * @brief outer namespace
+ **/
+namespace srilakshmikanthanp
+{
+    /**
+     * @namespace art
+     * @brief contains art classes and functions
+     **/
+    namespace art
+    {
+        /**
+         * @brief  decodes next codepoint from text, text of one
+         *         byte units is UTF-8 and two byte units is UTF-16,
+         *         wider units are codepoints. invalid sequence is
+         *         taken as value of its first unit.
+         * @param  it current position, moved past the codepoint
+         * @param  end end of text
+         * @return codepoint
+         **/
+        template <typename CharT>
+        char32_t artlib_decode( const CharT *&it, const CharT *end ) noexcept
+        {
+            using unit_type = std::make_unsigned_t<CharT>;
+
+            char32_t first = static_cast<unit_type>( *it++ );
+
+            if constexpr ( sizeof( CharT ) == 1 )
+            {
+                if ( first < 0x80 )
+                {
+                    return first;
+                }
+
+                std::size_t count = first >= 0xF0 ? 3 : first >= 0xE0 ? 2 : first >= 0xC0 ? 1 : 0;
+                char32_t    code  = first & ( 0x3F >> count );
+
+                if ( count == 0 || first > 0xF4 || static_cast<std::size_t>( end - it ) < count )
+                {
+                    return first;
+                }
+
+                for ( std::size_t i = 0; i < count; i++ )
+                {
+                    char32_t next = static_cast<unit_type>( it[i] );
+
+                    if ( ( next & 0xC0 ) != 0x80 )
+                    {
+                        return first;
+                    }
+
+                    code = ( code << 6 ) | ( next & 0x3F );
+                }
+
+                // overlong, surrogate or out of range
+                static constexpr char32_t least[] = { 0, 0x80, 0x800, 0x10000 };
+
+                if ( code < least[count] || ( code >= 0xD800 && code <= 0xDFFF ) || code > 0x10FFFF )
+                {
+                    return first;
+                }
+
+                it += count;
+
+                return code;
+            }
+            else if constexpr ( sizeof( CharT ) == 2 )
+            {
+                if ( first >= 0xD800 && first <= 0xDBFF && it != end )
+                {
+                    char32_t next = static_cast<unit_type>( *it );
+
+                    if ( next >= 0xDC00 && next <= 0xDFFF )
+                    {
+                        ++it;
+                        return 0x10000 + ( ( first - 0xD800 ) << 10 ) + ( next - 0xDC00 );
+                    }
+                }
+
+                return first;
+            }
+            else
+            {
+                return first;
+            }
+        }
+
+        /**
+         * @class  artlib_page_table
+         * @brief  two level table from codepoint to index, top
+         *         level is indexed by codepoint / 256 and gives
+         *         page of 256 indexes, pages are made only for
+         *         codepoints in use
+         * @tparam Index index type
+         * @tparam Alloc allocator type
+         **/
+        template <typename Index, template <typename> typename Alloc = std::allocator>
+        class artlib_page_table
+        {
+           public:
+            using index_type = Index;
+
+            /**
+             * @brief index of codepoint not in table
+             **/
+            static constexpr index_type npos = static_cast<index_type>( -1 );
+
+            /**
+             * @brief largest codepoint
+             **/
+            static constexpr char32_t max_code = 0x10FFFF;
+
+           private:
+            static constexpr std::size_t page_size = 256;
+
+            /**
+             * @brief page number + 1 of codepoint / 256, 0 if
+             *        there is no page
+             **/
+            std::vector<index_type, Alloc<index_type>> top;
+
+            /**
+             * @brief pages one after other
+             **/
+            std::vector<index_type, Alloc<index_type>> pages;
+
+           public:
+            /**
+             * @brief clears the contents
+             **/
+            void clear() noexcept
+            {
+                this->top.clear();
+                this->pages.clear();
+            }
+
+            /**
+             * @brief swap contents
+             * @param obj object to swap
+             **/
+            void swap( artlib_page_table &obj ) noexcept
+            {
+                using std::swap;
+                swap( this->top, obj.top );
+                swap( this->pages, obj.pages );
+            }
+
+            /**
+             * @brief adds or replaces index of codepoint
+             * @param code codepoint
+             * @param idx index
+             **/
+            void insert( char32_t code, index_type idx )
+            {
+                if ( code > max_code )
+                {
+                    return;
+                }
+
+                std::size_t hi = code / page_size;
+
+                if ( hi >= this->top.size() )
+                {
+                    this->top.resize( hi + 1, 0 );
+                }
+
+                if ( this->top[hi] == 0 )
+                {
+                    this->pages.resize( this->pages.size() + page_size, npos );
+                    this->top[hi] = static_cast<index_type>( this->pages.size() / page_size );
+                }
+
+                this->pages[( this->top[hi] - 1 ) * page_size + code % page_size] = idx;
+            }
+
+            /**
+             * @brief  finds index of codepoint
+             * @param  code codepoint
+             * @return index or npos
+             **/
+            index_type find( char32_t code ) const noexcept
+            {
+                std::size_t hi = code / page_size;
+
+                if ( hi >= this->top.size() || this->top[hi] == 0 )
+                {
+                    return npos;
+                }
+
+                return this->pages[( this->top[hi] - 1 ) * page_size + code % page_size];
+            }
+        };
+
+        /**
+         * @brief swap two artlib_page_table
+         * @param lhs object one to swap
+         * @param rhs object two to swap
+         **/
+        template <typename Index, template <typename> typename Alloc>
+        void swap( artlib_page_table<Index, Alloc> &lhs,
+                   artlib_page_table<Index, Alloc> &rhs ) noexcept
+        {
+            lhs.swap( rhs );
+        }
+
+    } // namespace art
+
+} // namespace srilakshmikanthanp
+
+#endif
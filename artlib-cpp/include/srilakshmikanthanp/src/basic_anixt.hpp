@@ -11,7 +11,9 @@
 #define BASIC_ANIXT_HEADER
 
 #include "anixt_config.hpp"
+#include "anixt_renderer.hpp"
 #include "filesystem"
+#include "memory"
 #include "ostream"
 #include "sstream"
 
@@ -33,7 +35,9 @@ namespace srilakshmikanthanp
     {
         /**
          * @class  basic_anixt
-         * @brief  primary class for anixt library
+         * @brief  primary class for anixt library, text written to
+         *         stream is rendered by basic_anixt_renderer, it is
+         *         not thread safe as renderer
          * @tparam StyleT style_type
          * @tparam FontT font _type
          * @tparam Anixtconfig anixt_config
@@ -45,20 +49,23 @@ namespace srilakshmikanthanp
             using base = std::basic_ostream<BASIC_ANIXT_BASE_PARAM>;
 
            public:
-            using style_type   = StyleT;
-            using font_type    = FontT;
-            using anixt_config = Anixtconfig;
+            using style_type     = StyleT;
+            using font_type      = FontT;
+            using anixt_config   = Anixtconfig;
+            using vertical_type  = anixt_vertical;
+            using renderer_type  = basic_anixt_renderer<StyleT, FontT, Anixtconfig>;
+            using batch_type     = typename renderer_type::batch_type;
+            using allocator_type = typename anixt_config::allocator_type;
 
            private:
-            using char_type    = typename anixt_config::char_type;
-            using size_type    = typename anixt_config::size_type;
-            using traits_type  = typename anixt_config::traits_type;
-            using string_type  = typename anixt_config::string_type;
-            using shrink_type  = typename anixt_config::shrink;
-            using anixt_letter = typename anixt_config::anixt_letter;
-            using anixt_string = typename anixt_config::anixt_string;
-            template <typename T>
-            using vector_type = typename anixt_config::template vector_type<T>;
+            using char_type        = typename anixt_config::char_type;
+            using size_type        = typename anixt_config::size_type;
+            using traits_type      = typename anixt_config::traits_type;
+            using string_type      = typename anixt_config::string_type;
+            using string_view_type = typename anixt_config::string_view_type;
+            using anixt_string     = typename anixt_config::anixt_string;
+            using anixt_canvas     = typename anixt_config::anixt_canvas;
+            using anixt_extent     = typename anixt_config::anixt_extent;
             template <typename T>
             using alloc_type = typename anixt_config::template alloc_type<T>;
 
@@ -66,10 +73,8 @@ namespace srilakshmikanthanp
             using string_buff_type = std::basic_stringbuf<char_type, traits_type, alloc_type<char_type>>;
 
            private:
-            string_buff_type   string_buff;
-            anixt_config       config;
-            mutable font_type  font;
-            mutable style_type style;
+            string_buff_type string_buff;
+            renderer_type    renderer;
 
             /**
              * @brief converts ascii character of std::string
@@ -80,6 +85,26 @@ namespace srilakshmikanthanp
                 return string_type( str.begin(), str.end() );
             }
 
+#if __cplusplus > 201703L
+            /**
+             * @brief  text of buffer without copy
+             * @return view of string buffer
+             **/
+            string_view_type text() const noexcept
+            {
+                return this->string_buff.view();
+            }
+#else
+            /**
+             * @brief  text of buffer, stringbuf of C++17 has no view
+             * @return copy of string buffer
+             **/
+            string_type text() const
+            {
+                return this->string_buff.str();
+            }
+#endif
+
            public:
             /**
              * @brief default constructor
@@ -101,7 +126,8 @@ namespace srilakshmikanthanp
              **/
             basic_anixt( basic_anixt &&obj ) noexcept
                 : base( std::move( obj ) ),
-                  string_buff( std::move( obj.string_buff ) )
+                  string_buff( std::move( obj.string_buff ) ),
+                  renderer( std::move( obj.renderer ) )
             {
                 base::set_rdbuf( &this->string_buff );
             }
@@ -123,6 +149,7 @@ namespace srilakshmikanthanp
             {
                 base::operator    =( std::move( obj ) );
                 this->string_buff = std::move( obj.string_buff );
+                this->renderer    = std::move( obj.renderer );
                 return *this;
             }
 
@@ -137,6 +164,19 @@ namespace srilakshmikanthanp
                 this->init( &string_buff );
             }
 
+            /**
+             * @brief constructor, renderer is made with alloc, see
+             *        basic_anixt_renderer. buffer of stream is not
+             * @param alloc allocator
+             **/
+            explicit basic_anixt( const allocator_type &alloc )
+                : base(),
+                  string_buff( std::ios_base::out ),
+                  renderer( alloc )
+            {
+                this->init( &string_buff );
+            }
+
             /**
              * @brief constructor
              * @param fp full path to file
@@ -145,15 +185,8 @@ namespace srilakshmikanthanp
                 : base(),
                   string_buff( std::ios_base::out )
             {
-                this->font.set_font( fp );
-                this->config = this->font.get_anixt_config();
-                this->style.set_anixt_config( this->config );
                 this->init( &string_buff );
-
-                if ( !( style_type::shrink_level <= this->config.Shrink ) )
-                {
-                    throw std::runtime_error( "Style is not supported" );
-                }
+                this->set_font( fp );
             }
 
             /**
@@ -163,9 +196,7 @@ namespace srilakshmikanthanp
             {
                 base::clear();
                 this->operator()("");
-                this->config.clear();
-                this->font.clear();
-                this->style.clear();
+                this->renderer.clear();
             }
 
             /**
@@ -177,9 +208,7 @@ namespace srilakshmikanthanp
                 using std::swap;
                 base::swap( obj );
                 string_buff.swap( obj.string_buff );
-                swap( this->config, obj.config );
-                swap( this->font, obj.font );
-                swap( this->style, obj.style );
+                swap( this->renderer, obj.renderer );
             }
 
             /**
@@ -211,20 +240,81 @@ namespace srilakshmikanthanp
             }
 
             /**
-             * @brief used to set font file
+             * @brief  returns renderer of anixt
+             * @return basic_anixt_renderer
+             **/
+            const renderer_type &get_renderer() const noexcept
+            {
+                return this->renderer;
+            }
+
+            /**
+             * @brief used to set font file, font is loaded once
+             *        and shared by all instance using same file
              * @param fp full path to font file
              **/
             void set_font( const std::filesystem::path &fp )
             {
                 this->clear();
-                this->font.set_font( fp );
-                this->config = this->font.get_anixt_config();
-                this->style.set_config( this->config );
+                this->renderer.set_font( fp );
+            }
+
+            /**
+             * @brief used to set loaded font
+             * @param font font shared with others
+             **/
+            void set_font( std::shared_ptr<const font_type> font )
+            {
+                this->clear();
+                this->renderer.set_font( std::move( font ) );
+            }
+
+            /**
+             * @brief  returns font in use
+             * @return shared font
+             **/
+            std::shared_ptr<const font_type> get_font() const
+            {
+                return this->renderer.get_font();
+            }
+
+            /**
+             * @brief sets how lines of text are stacked, it is
+             *        kept when font is set
+             * @param vertical vertical_type
+             **/
+            void set_vertical( vertical_type vertical ) noexcept
+            {
+                this->renderer.set_vertical( vertical );
+            }
+
+            /**
+             * @brief  returns how lines of text are stacked
+             * @return vertical_type
+             **/
+            vertical_type get_vertical() const noexcept
+            {
+                return this->renderer.get_vertical();
+            }
+
+            /**
+             * @brief sets width in columns that lines of anixt string
+             *        are wrapped to at spaces, 0 does not wrap. it
+             *        is kept when font is set
+             * @param columns width to wrap to
+             **/
+            void set_wrap( size_type columns ) noexcept
+            {
+                this->renderer.set_wrap( columns );
+            }
 
-                if ( !( style_type::shrink_level <= this->config.Shrink ) )
-                {
-                    throw std::runtime_error( "Style is not supported" );
-                }
+            /**
+             * @brief  returns width that lines are wrapped to
+             * @return columns, 0 if lines are not wrapped
+             **/
+            size_type get_wrap() const noexcept
+            {
+                return this->renderer.get_wrap();
             }
 
             /**
@@ -233,7 +323,31 @@ namespace srilakshmikanthanp
              **/
             anixt_config get_anixt_config()
             {
-                return this->config;
+                return this->renderer.get_anixt_config();
+            }
+
+            /**
+             * @brief renders anixt string of text in to canvas,
+             *        buffers of canvas and of anixt are reused so
+             *        rendering in a loop does not allocate once they
+             *        are large enough
+             * @param text text to render
+             * @param canvas anixt_canvas to render in
+             **/
+            void render_into( string_view_type text, anixt_canvas &canvas ) const
+            {
+                this->renderer.render_into( text, canvas );
+            }
+
+            /**
+             * @brief renders anixt string of text in to out, rows of
+             *        out and their buffers are reused
+             * @param text text to render
+             * @param out anixt_string to render in
+             **/
+            void render_into( string_view_type text, anixt_string &out ) const
+            {
+                this->renderer.render_into( text, out );
             }
 
             /**
@@ -242,18 +356,97 @@ namespace srilakshmikanthanp
              **/
             anixt_string get_anixt_string() const
             {
-                string_type               buff { this->operator()() };
-                vector_type<anixt_letter> anixtletters;
-                anixt_string              anixtstring;
+                return this->renderer.render( this->text() );
+            }
+
+            /**
+             * @brief renders anixt string in to canvas, buffer of
+             *        canvas is reused so rendering in a loop does
+             *        not allocate once it is large enough
+             * @param canvas anixt_canvas to render in
+             **/
+            void get_anixt_canvas( anixt_canvas &canvas ) const
+            {
+                this->renderer.render_into( this->text(), canvas );
+            }
+
+            /**
+             * @brief  width and height of anixt string of text without
+             *         building it, see basic_anixt_renderer
+             * @param  text text to measure
+             * @return width and height
+             **/
+            anixt_extent measure( string_view_type text ) const
+            {
+                return this->renderer.measure( text );
+            }
+
+            /**
+             * @brief  width and height of anixt string of buffer
+             * @return width and height
+             **/
+            anixt_extent measure() const
+            {
+                return this->measure( this->text() );
+            }
+
+            /**
+             * @brief writes rows of anixt string of text to sink
+             *        without building it, see basic_anixt_renderer
+             * @param text text to write
+             * @param sink sink to write to, see artlib_sink
+             **/
+            template <typename Sink>
+            void write_to( string_view_type text, Sink &sink ) const
+            {
+                this->renderer.write_to( text, sink );
+            }
+
+            /**
+             * @brief writes rows of anixt string of buffer to sink
+             * @param sink sink to write to, see artlib_sink
+             **/
+            template <typename Sink>
+            void write_to( Sink &sink ) const
+            {
+                this->write_to( this->text(), sink );
+            }
+
+            /**
+             * @brief renders texts of [first, last) in to batch, see
+             *        basic_anixt_renderer
+             * @param first begin of texts
+             * @param last end of texts
+             * @param batch basic_anixt_batch to render in
+             **/
+            template <typename It>
+            void render_batch( It first, It last, batch_type &batch ) const
+            {
+                this->renderer.render_batch( first, last, batch );
+            }
 
-                for ( auto i : buff )
-                {
-                    anixtletters.push_back( this->font( i ) );
-                }
+            /**
+             * @brief renders texts in to batch, see basic_anixt_renderer
+             * @param texts range of texts
+             * @param batch basic_anixt_batch to render in
+             **/
+            template <typename Range>
+            void render_batch( const Range &texts, batch_type &batch ) const
+            {
+                this->renderer.render_batch( texts, batch );
+            }
+
+            /**
+             * @brief returns anixt string as canvas
+             * @return anixt_canvas
+             **/
+            anixt_canvas get_anixt_canvas() const
+            {
+                anixt_canvas canvas( this->renderer.get_allocator() );
 
-                anixtstring = style( anixtletters );
+                this->get_anixt_canvas( canvas );
 
-                return anixtstring;
+                return canvas;
             }
         };
 
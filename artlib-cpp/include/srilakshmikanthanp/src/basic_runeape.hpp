@@ -10,7 +10,9 @@
 #ifndef BASIC_RUNEAPE
 #define BASIC_RUNEAPE
 
+#include "artlib_registry.hpp"
 #include "filesystem"
+#include "memory"
 #include "runeape_config.hpp"
 
 /**
@@ -27,7 +29,8 @@ namespace srilakshmikanthanp
     {
         /**
          * @class  basic_runeape
-         * @brief  primary class for runeape library
+         * @brief  primary class for runeape library, const methods
+         *         reuse buffers so it is not thread safe
          * @tparam StyleT style_type
          * @tparam GalleryT gallery_type
          * @tparam Runeapeconfig runeape_config
@@ -39,21 +42,69 @@ namespace srilakshmikanthanp
             using style_type     = StyleT;
             using gallery_type   = GalleryT;
             using runeape_config = Runeapeconfig;
+            using allocator_type = typename runeape_config::allocator_type;
 
            private:
-            using char_type     = typename runeape_config::char_type;
-            using size_type     = typename runeape_config::size_type;
-            using string_type   = typename runeape_config::string_type;
-            using shrink_type   = typename runeape_config::shrink;
-            using runeape_image = typename runeape_config::runeape_image;
+            using char_type      = typename runeape_config::char_type;
+            using size_type      = typename runeape_config::size_type;
+            using string_type    = typename runeape_config::string_type;
+            using shrink_type    = typename runeape_config::shrink;
+            using runeape_image  = typename runeape_config::runeape_image;
+            using runeape_canvas = typename runeape_config::runeape_canvas;
+            using runeape_extent = typename runeape_config::runeape_extent;
+            using runeape_glyph  = typename runeape_config::runeape_glyph;
             template <typename T>
             using vector_type = typename runeape_config::template vector_type<T>;
 
            private:
-            mutable style_type       style;
-            mutable gallery_type     gallery;
-            runeape_config           config;
-            vector_type<string_type> imgnames;
+            mutable style_type                  style;
+            std::shared_ptr<const gallery_type> gallery;
+            runeape_config                      config;
+            vector_type<string_type>            imgnames;
+            mutable vector_type<runeape_glyph>  glyphs;
+            mutable runeape_canvas              scratch;
+            mutable vector_type<string_type>    spare;
+
+            /**
+             * @brief  collects glyphs of images and passes them to
+             *         fn, vector of glyphs is kept for next render
+             * @param  names image names
+             * @param  fn called with vector of runeape_glyph
+             * @return result of fn
+             **/
+            template <typename Fn>
+            auto render( const vector_type<string_type> &names, Fn fn ) const
+            {
+                vector_type<runeape_glyph> &images = this->glyphs;
+
+                if ( !this->gallery )
+                {
+                    throw std::runtime_error( "Gallery is not set" );
+                }
+
+                images.clear();
+                images.reserve( names.size() );
+
+                for ( const auto &i : names )
+                {
+                    images.push_back( ( *this->gallery )( i ) );
+                }
+
+                // glyphs of validated gallery are known to be Height
+                // rows, styles compose without check
+                if ( !this->gallery->validated() )
+                {
+                    for ( const auto &ri : images )
+                    {
+                        if ( ri.size() != this->config.Height )
+                        {
+                            throw std::runtime_error( "Height should be equal" );
+                        }
+                    }
+                }
+
+                return fn( images );
+            }
 
             /**
              * @brief converts ascii character of std::string
@@ -79,15 +130,31 @@ namespace srilakshmikanthanp
              **/
             basic_runeape( const std::filesystem::path &fp )
             {
-                this->clear();
-                this->gallery.set_gallery( fp );
-                this->config = this->gallery.get_runeape_config();
-                this->style.set_config( this->config );
+                this->set_gallery( fp );
+            }
 
-                if ( !( style_type::shrink_level <= this->config.Shrink ) )
-                {
-                    throw std::runtime_error( "style not supported" );
-                }
+            /**
+             * @brief constructor, image names, scratch of runeape and
+             *        style and runeape_image returned are allocated
+             *        by alloc. gallery is shared so it is not
+             * @param alloc allocator
+             **/
+            explicit basic_runeape( const allocator_type &alloc )
+                : style( alloc ),
+                  imgnames( alloc ),
+                  glyphs( alloc ),
+                  scratch( alloc ),
+                  spare( alloc )
+            {
+            }
+
+            /**
+             * @brief  allocator of runeape
+             * @return allocator
+             **/
+            allocator_type get_allocator() const noexcept
+            {
+                return allocator_type( this->spare.get_allocator() );
             }
 
             /**
@@ -96,9 +163,12 @@ namespace srilakshmikanthanp
             void clear()
             {
                 this->style.clear();
-                this->gallery.clear();
+                this->gallery.reset();
                 this->config.clear();
                 this->imgnames.clear();
+                this->glyphs.clear();
+                this->scratch.clear();
+                this->spare.clear();
             }
 
             /**
@@ -112,17 +182,33 @@ namespace srilakshmikanthanp
                 swap( this->gallery, obj.gallery );
                 swap( this->config, obj.config );
                 swap( this->imgnames, obj.imgnames );
+                swap( this->glyphs, obj.glyphs );
+                swap( this->scratch, obj.scratch );
+                swap( this->spare, obj.spare );
             }
 
             /**
-             * @brief used to set gallery file
+             * @brief used to set gallery file, gallery is loaded
+             *        once and shared by all instance using same file
              * @param fp full path to gallery file
              **/
             void set_gallery( const std::filesystem::path &fp )
+            {
+                this->set_gallery( artlib_registry<gallery_type>::instance().acquire(
+                    fp, []( gallery_type &gallery, const std::filesystem::path &path ) {
+                        gallery.set_gallery( path );
+                    } ) );
+            }
+
+            /**
+             * @brief used to set loaded gallery
+             * @param gallery gallery shared with others
+             **/
+            void set_gallery( std::shared_ptr<const gallery_type> gallery )
             {
                 this->clear();
-                this->gallery.set_gallery( fp );
-                this->config = this->gallery.get_runeape_config();
+                this->gallery = std::move( gallery );
+                this->config  = this->gallery->get_runeape_config();
                 this->style.set_config( this->config );
 
                 if ( !( style_type::shrink_level <= this->config.Shrink ) )
@@ -131,6 +217,15 @@ namespace srilakshmikanthanp
                 }
             }
 
+            /**
+             * @brief  returns gallery in use
+             * @return shared gallery
+             **/
+            std::shared_ptr<const gallery_type> get_gallery() const
+            {
+                return this->gallery;
+            }
+
             /**
              * @brief saves(append) imagename
              * @param imagname image name
@@ -170,23 +265,91 @@ namespace srilakshmikanthanp
                 return this->config;
             }
 
+            /**
+             * @brief renders runeape_image of images in to canvas,
+             *        buffers of canvas and of runeape are reused so
+             *        rendering in a loop does not allocate once they
+             *        are large enough
+             * @param names image names
+             * @param canvas runeape_canvas to render in
+             **/
+            void render_into( const vector_type<string_type> &names, runeape_canvas &canvas ) const
+            {
+                this->render( names, [this, &canvas]( const vector_type<runeape_glyph> &images ) {
+                    this->style( images, canvas );
+                } );
+            }
+
+            /**
+             * @brief renders runeape_image of images in to out, rows
+             *        of out and their buffers are reused
+             * @param names image names
+             * @param out runeape_image to render in
+             **/
+            void render_into( const vector_type<string_type> &names, runeape_image &out ) const
+            {
+                this->render_into( names, this->scratch );
+                this->scratch.to( out, this->spare );
+            }
+
             /**
              * @brief returns runeape_image
              * @return runeape_image
              **/
             runeape_image get_runeape_image() const
             {
-                vector_type<runeape_image> images;
-                runeape_image              image;
+                runeape_image ret( this->get_allocator() );
 
-                for ( const auto &i : this->imgnames )
-                {
-                    images.push_back( this->gallery( i ) );
-                }
+                this->render_into( this->imgnames, ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief renders runeape_image in to canvas, buffer of
+             *        canvas is reused
+             * @param canvas runeape_canvas to render in
+             **/
+            void get_runeape_canvas( runeape_canvas &canvas ) const
+            {
+                this->render_into( this->imgnames, canvas );
+            }
+
+            /**
+             * @brief  width and height of runeape_image of images
+             *         without building it, width is found from
+             *         glyphs by style
+             * @param  names image names
+             * @return width and height
+             **/
+            runeape_extent measure( const vector_type<string_type> &names ) const
+            {
+                return this->render( names, [this]( const vector_type<runeape_glyph> &images ) {
+                    return runeape_extent { this->style.measure( images ), this->config.Height };
+                } );
+            }
+
+            /**
+             * @brief  width and height of runeape_image of loaded
+             *         images
+             * @return width and height
+             **/
+            runeape_extent measure() const
+            {
+                return this->measure( this->imgnames );
+            }
+
+            /**
+             * @brief returns runeape_image as canvas
+             * @return runeape_canvas
+             **/
+            runeape_canvas get_runeape_canvas() const
+            {
+                runeape_canvas canvas( this->get_allocator() );
 
-                image = this->style( images );
+                this->get_runeape_canvas( canvas );
 
-                return image;
+                return canvas;
             }
         };
 
@@ -13,6 +13,8 @@
 #include "memory"
 #include "ostream"
 #include "string"
+#include "string_view"
+#include "artlib_canvas.hpp"
 #include "artlib_data.hpp"
 #include "type_traits"
 #include "vector"
@@ -47,10 +49,22 @@ namespace srilakshmikanthanp
             using traits_type = Traits;
             template <typename T>
             using alloc_type  = Alloc<T>;
+            using allocator_type = Alloc<CharT>;
             using string_type = std::basic_string<CharT, Traits, Alloc<CharT>>;
+            using string_view_type = std::basic_string_view<CharT, Traits>;
             template <typename T>
             using vector_type = std::vector<T, Alloc<T>>;
 
+            /**
+             * @brief runeape canvas type, rows in one buffer
+             **/
+            using runeape_canvas = artlib_canvas<CharT, Traits, Alloc>;
+
+            /**
+             * @brief width and height of runeape canvas
+             **/
+            using runeape_extent = artlib_extent<SizeT>;
+
             /**
              * @struct runeape_image
              * @brief  runeape image type
@@ -61,6 +75,42 @@ namespace srilakshmikanthanp
                 using base::base;
             };
 
+            /**
+             * @struct runeape_glyph
+             * @brief  view of image in gallery, rows are height
+             *         rows of width one after other in gallery
+             *         storage, left and right are edges of rows
+             *         found at load(see artlib_edges), valid as
+             *         long as gallery is alive
+             **/
+            struct runeape_glyph
+            {
+                const char_type *rows { nullptr };
+                size_type        width { 0 };
+                size_type        height { 0 };
+                const size_type *left { nullptr };
+                const size_type *right { nullptr };
+
+                /**
+                 * @brief  number of rows
+                 * @return height
+                 **/
+                size_type size() const noexcept
+                {
+                    return this->height;
+                }
+
+                /**
+                 * @brief  row of image
+                 * @param  i index of row
+                 * @return view of row
+                 **/
+                string_view_type operator[]( size_type i ) const noexcept
+                {
+                    return string_view_type( this->rows + i * this->width, this->width );
+                }
+            };
+
             /**
              * @brief shrink level
              * 
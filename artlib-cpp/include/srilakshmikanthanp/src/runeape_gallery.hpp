@@ -10,9 +10,11 @@
 #ifndef RUNEAPE_GALLERY
 #define RUNEAPE_GALLERY
 
+#include "algorithm"
+#include "artlib_json.hpp"
 #include "filesystem"
 #include "fstream"
-#include "third_party/json/json.hpp"
+#include "map"
 #include "runeape_config.hpp"
 
 /**
@@ -30,7 +32,10 @@ namespace srilakshmikanthanp
         /**
          * @struct basic_runeape_base_gallery
          * @brief  abstract type of gallery class the used
-         *         by runeape
+         *         by runeape. gallery is shared by runeapes so
+         *         get_runeape_config and operator() are const,
+         *         galleries that override non const ones should
+         *         be made const
          * @tparam Runapeconfig type of runeape_config
          **/
         template <typename Runeapeconfig>
@@ -62,15 +67,27 @@ namespace srilakshmikanthanp
              * @brief  used to get runeape config from font file
              * @return runeape_config
              **/
-            virtual runeape_config get_runeape_config() = 0;
+            virtual runeape_config get_runeape_config() const = 0;
 
             /**
-             * @brief used to get runeape_image from gallery
+             * @brief used to get runeape_glyph from gallery,
+             *        glyph refers gallery storage
              * @param imgname image name
-             * @return uneape_image
+             * @return runeape_glyph
              **/
-            virtual typename runeape_config::runeape_image
-            operator()( const typename runeape_config::string_type &imgname ) = 0;
+            virtual typename runeape_config::runeape_glyph
+            operator()( const typename runeape_config::string_type &imgname ) const = 0;
+
+            /**
+             * @brief  tells gallery is validated at load, glyphs of
+             *         validated gallery are Height rows and need no
+             *         check at render
+             * @return true if validated
+             **/
+            virtual bool validated() const noexcept
+            {
+                return false;
+            }
         };
 
         /**
@@ -98,26 +115,131 @@ namespace srilakshmikanthanp
             using string_type = typename base::runeape_config::string_type;
             template <typename T>
             using vector_type   = typename base::runeape_config::template vector_type<T>;
-            using runeape_image = typename base::runeape_config::runeape_image;
+            using runeape_glyph = typename base::runeape_config::runeape_glyph;
             using json_type     = nlohmann::basic_json<std::map, std::vector,
                                                    string_type, bool, int64_t,
                                                    size_type, double, alloc_type>;
 
+            /**
+             * @struct image_entry
+             * @brief  offset and width of image in image_rows and
+             *         offset of its edges in left and right
+             **/
+            struct image_entry
+            {
+                size_type offset;
+                size_type width;
+                size_type edge;
+            };
+
+            using image_map = std::map<string_type, image_entry, std::less<string_type>,
+                                       alloc_type<std::pair<const string_type, image_entry>>>;
+
            private:
             /**
-             * @brief stores gallery file.
+             * @brief stores runeape_config of gallery
+             **/
+            runeape_config config {};
+
+            /**
+             * @brief stores rows of all images, image rows are
+             *        stored one after other with equal width
              **/
-            json_type json_gallery;
+            string_type image_rows;
+
+            /**
+             * @brief stores image_entry by image name
+             **/
+            image_map images;
+
+            /**
+             * @brief true if gallery is validated
+             **/
+            bool valid { false };
+
+            /**
+             * @brief stores edges of rows of all images
+             **/
+            vector_type<size_type> left, right;
 
             /**
              * @brief converts ascii character of std::string
              *        to anixt_config::string_type
              **/
-            string_type cvt( const std::string &str )
+            static string_type cvt( const std::string &str )
             {
                 return string_type( str.begin(), str.end() );
             }
 
+            /**
+             * @struct decoder
+             * @brief  receives config and images of json gallery
+             *         from artlib_json_sax and fills the images
+             **/
+            struct decoder
+            {
+                basic_runeape_json_gallery &                           gallery;
+                artlib_json_rows<string_type, vector_type<size_type>> packer;
+                string_type                                            name {};
+                size_type                                              min_rows { string_type::npos };
+                size_type                                              max_rows { 0 };
+                unsigned int                                           seen { 0 };
+
+                explicit decoder( basic_runeape_json_gallery &gallery )
+                    : gallery( gallery ),
+                      packer( gallery.image_rows )
+                {
+                }
+
+                void config( const string_type &key, long long value )
+                {
+                    if ( value < 0 )
+                    {
+                        throw std::runtime_error( "Negative value in config" );
+                    }
+
+                    if ( key == cvt( "HardBlank" ) )
+                    {
+                        this->gallery.config.HardBlank = static_cast<char_type>( value );
+                        this->seen |= 1;
+                    }
+                    else if ( key == cvt( "Height" ) )
+                    {
+                        this->gallery.config.Height = static_cast<size_type>( value );
+                        this->seen |= 2;
+                    }
+                    else if ( key == cvt( "Shrink" ) )
+                    {
+                        this->gallery.config.Shrink = static_cast<shrink_type>( value );
+                        this->seen |= 4;
+                    }
+                }
+
+                void begin( const string_type &name )
+                {
+                    this->name = name;
+                    this->packer.begin();
+                }
+
+                void row( const string_type &str )
+                {
+                    this->packer.row( str );
+                }
+
+                void end()
+                {
+                    size_type width = this->packer.end();
+                    size_type edge  = this->gallery.left.size();
+
+                    artlib_edges( this->gallery.image_rows.data() + this->packer.offset(), width,
+                                  this->packer.count(), this->gallery.left, this->gallery.right );
+
+                    this->gallery.images[this->name] = image_entry { this->packer.offset(), width, edge };
+                    this->min_rows                   = std::min( this->min_rows, this->packer.count() );
+                    this->max_rows                   = std::max( this->max_rows, this->packer.count() );
+                }
+            };
+
            public:
             basic_runeape_json_gallery()                                         = default;
             basic_runeape_json_gallery( const basic_runeape_json_gallery & )     = default;
@@ -132,7 +254,12 @@ namespace srilakshmikanthanp
              **/
             void clear() override
             {
-                this->json_gallery.clear();
+                this->config.clear();
+                this->image_rows.clear();
+                this->images.clear();
+                this->left.clear();
+                this->right.clear();
+                this->valid = false;
             }
 
             /**
@@ -142,12 +269,18 @@ namespace srilakshmikanthanp
             void swap( basic_runeape_json_gallery &obj )
             {
                 using std::swap;
-                swap( this->json_gallery, obj.json_gallery );
+                swap( this->config, obj.config );
+                swap( this->image_rows, obj.image_rows );
+                swap( this->images, obj.images );
+                swap( this->left, obj.left );
+                swap( this->right, obj.right );
+                swap( this->valid, obj.valid );
             }
 
             /**
              * @brief used to set gallery file, call this before 
-             *        any other operation.
+             *        any other operation. gallery is streamed
+             *        straight in to images without json tree.
              * @param fp full path to gallery file
              **/
             void set_gallery( const std::filesystem::path &fp ) override
@@ -164,36 +297,79 @@ namespace srilakshmikanthanp
                     throw std::runtime_error( "Unable to open file" );
                 }
 
-                gallery_file >> this->json_gallery;
+                this->clear();
+
+                decoder                             dec( *this );
+                artlib_json_sax<json_type, decoder> sax( dec, cvt( "runeape_config" ), cvt( "runeape_image" ) );
+
+                try
+                {
+                    sax.parse( gallery_file );
+
+                    if ( dec.seen != 7 )
+                    {
+                        throw std::runtime_error( "runeape_config not found" );
+                    }
+
+                    if ( dec.max_rows != 0 &&
+                         ( dec.min_rows != this->config.Height || dec.max_rows != this->config.Height ) )
+                    {
+                        throw std::runtime_error( "Height should be equal" );
+                    }
+
+                    artlib_validate_config( this->config, shrink_type::level_1 );
+
+                    for ( const auto &image : this->images )
+                    {
+                        artlib_validate_rows( this->image_rows.data(), this->image_rows.size(), image.second.offset,
+                                              image.second.width, this->config.Height );
+                    }
+
+                    this->valid = true;
+                }
+                catch ( ... )
+                {
+                    this->clear();
+                    throw;
+                }
             }
 
             /**
              * @brief  used to get runeape_config
              * @return runeape_config
              **/
-            runeape_config get_runeape_config() override
+            runeape_config get_runeape_config() const override
             {
-                runeape_config ret;
-
-                ret.HardBlank = this->json_gallery[cvt( "runeape_config" )][cvt( "HardBlank" )]
-                                    .template get<size_type>();
-                ret.Height    = this->json_gallery[cvt( "runeape_config" )][cvt( "Height" )]
-                                    .template get<size_type>();
-                ret.Shrink    = this->json_gallery[cvt( "runeape_config" )][cvt( "Shrink" )]
-                                    .template get<shrink_type>();
+                return this->config;
+            }
 
-                return ret;
+            /**
+             * @brief  tells gallery is validated at load
+             * @return true if validated
+             **/
+            bool validated() const noexcept override
+            {
+                return this->valid;
             }
 
             /**
-             * @brief used to get runeape_image from gallery
+             * @brief used to get runeape_glyph from gallery
              * @param imgname image name
-             * @return uneape_image
+             * @return runeape_glyph
              **/
-            runeape_image operator()( const string_type &imgname ) override
+            runeape_glyph operator()( const string_type &imgname ) const override
             {
-                return this->json_gallery[cvt( "runeape_image" )][imgname]
-                           .template get<runeape_image>();
+                auto it = this->images.find( imgname );
+
+                if ( it == this->images.end() )
+                {
+                    throw std::runtime_error( "Image not found in gallery" );
+                }
+
+                const image_entry &entry = it->second;
+
+                return runeape_glyph { this->image_rows.data() + entry.offset, entry.width, this->config.Height,
+                                       this->left.data() + entry.edge, this->right.data() + entry.edge };
             }
         };
 
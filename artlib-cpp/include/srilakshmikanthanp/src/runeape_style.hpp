@@ -59,12 +59,44 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get runeape_image asper the style
-             * @param  rimgs vector of runeape_image
+             * @param  rimgs vector of runeape_glyph
              * @return runeape_image
              **/
             virtual typename runeape_config::runeape_image
             operator()( const typename runeape_config::template vector_type<
-                        typename runeape_config::runeape_image> &rimgs ) = 0;
+                        typename runeape_config::runeape_glyph> &rimgs ) = 0;
+
+            /**
+             * @brief  used to render runeape_glyphs asper the style
+             *         in to canvas, buffer of canvas is reused
+             * @param  rimgs vector of runeape_glyph
+             * @param  canvas runeape_canvas to render in
+             **/
+            virtual void
+            operator()( const typename runeape_config::template vector_type<
+                        typename runeape_config::runeape_glyph> &rimgs,
+                        typename runeape_config::runeape_canvas &canvas )
+            {
+                canvas = typename runeape_config::runeape_canvas( ( *this )( rimgs ) );
+            }
+
+            /**
+             * @brief  width of runeape_image of runeape_glyphs asper
+             *         the style, styles find it without rendering
+             *         where they can
+             * @param  rimgs vector of runeape_glyph
+             * @return width
+             **/
+            virtual typename runeape_config::size_type
+            measure( const typename runeape_config::template vector_type<
+                     typename runeape_config::runeape_glyph> &rimgs )
+            {
+                typename runeape_config::runeape_canvas canvas;
+
+                ( *this )( rimgs, canvas );
+
+                return canvas.width();
+            }
         };
 
         /**
@@ -80,13 +112,17 @@ namespace srilakshmikanthanp
 
            public:
             using runeape_config = Runeapeconfig;
+            using allocator_type = typename runeape_config::allocator_type;
 
            private:
-            using char_type     = typename runeape_config::char_type;
-            using size_type     = typename runeape_config::size_type;
-            using string_type   = typename runeape_config::string_type;
-            using shrink_type   = typename runeape_config::shrink;
-            using runeape_image = typename runeape_config::runeape_image;
+            using char_type        = typename runeape_config::char_type;
+            using size_type        = typename runeape_config::size_type;
+            using string_type      = typename runeape_config::string_type;
+            using string_view_type = typename runeape_config::string_view_type;
+            using shrink_type      = typename runeape_config::shrink;
+            using runeape_image    = typename runeape_config::runeape_image;
+            using runeape_canvas   = typename runeape_config::runeape_canvas;
+            using runeape_glyph    = typename runeape_config::runeape_glyph;
             template <typename T>
             using vector_type = typename runeape_config::template vector_type<T>;
 
@@ -102,6 +138,12 @@ namespace srilakshmikanthanp
              **/
             runeape_config config;
 
+            /**
+             * @brief canvas that runeape_image is rendered in, kept
+             *        so its buffer is reused
+             **/
+            runeape_canvas scratch;
+
             /**
              * @brief converts ascii text of std::string to
              *        string_type
@@ -111,30 +153,6 @@ namespace srilakshmikanthanp
                 return string_type( str.begin(), str.end() );
             }
 
-            /**
-             * @brief checks Height equal or not
-             * @param img runeape_image
-             **/
-            void error_check( const runeape_image &img ) const
-            {
-                if ( img.size() != this->config.Height )
-                {
-                    throw std::runtime_error( "Height should be equal" );
-                }
-            }
-
-            /**
-             * @brief removes HardBlank
-             * @param rimg runeape_image
-             **/
-            void remove_hardblank( runeape_image &rimg )
-            {
-                for ( size_type i = 0; i < this->config.Height; i++ )
-                {
-                    std::replace( rimg[i].begin(), rimg[i].end(), this->config.HardBlank, ' ' );
-                }
-            }
-
            public:
             basic_runeape_untouched_style()                                            = default;
             basic_runeape_untouched_style( const basic_runeape_untouched_style & )     = default;
@@ -144,12 +162,23 @@ namespace srilakshmikanthanp
             basic_runeape_untouched_style &operator=( const basic_runeape_untouched_style & ) = default;
             basic_runeape_untouched_style &operator=( basic_runeape_untouched_style && ) noexcept = default;
 
+            /**
+             * @brief constructor, scratch of style is allocated by
+             *        alloc
+             * @param alloc allocator
+             **/
+            explicit basic_runeape_untouched_style( const allocator_type &alloc )
+                : scratch( alloc )
+            {
+            }
+
             /**
              * @brief clears the content
              **/
             void clear() override
             {
                 this->config.clear();
+                this->scratch.clear();
             }
 
             /**
@@ -160,6 +189,7 @@ namespace srilakshmikanthanp
             {
                 using std::swap;
                 swap( this->config, obj.config );
+                swap( this->scratch, obj.scratch );
             }
 
             /**
@@ -173,29 +203,67 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get runeape_image asper the style
-             * @param  rimgs vector of runeape_image
+             * @param  rimgs vector of runeape_glyph
              * @return runeape_image
              **/
-            runeape_image operator()( const vector_type<runeape_image> &rimgs ) override
+            runeape_image operator()( const vector_type<runeape_glyph> &rimgs ) override
             {
-                runeape_image rimg( this->config.Height, string_type() );
+                runeape_image ret( this->scratch.get_allocator() );
+
+                ( *this )( rimgs, this->scratch );
+
+                this->scratch.to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief  used to render runeape_glyphs in untouched style
+             *         in to canvas
+             * @param  rimgs vector of runeape_glyph
+             * @param  canvas runeape_canvas to render in
+             **/
+            void operator()( const vector_type<runeape_glyph> &rimgs, runeape_canvas &canvas ) override
+            {
+                size_type width = 0;
 
                 for ( const auto &ri : rimgs )
                 {
-                    this->error_check( ri );
+                    width += ri.width;
                 }
 
+                canvas.assign( width, this->config.Height, width );
+
+                // image rows are copied with HardBlank replaced in
+                // the same pass
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
+                    char_type *out = canvas.row_data( i );
+
                     for ( const auto &ri : rimgs )
                     {
-                        rimg[i] += ri[i];
+                        const string_view_type row = ri[i];
+
+                        out = artlib_replace_copy( row.data(), row.data() + row.size(), out, this->config.HardBlank, char_type( ' ' ) );
                     }
                 }
+            }
 
-                remove_hardblank( rimg );
+            /**
+             * @brief  width of runeape_glyphs in untouched style
+             * @param  rimgs vector of runeape_glyph
+             * @return width
+             **/
+            size_type measure( const vector_type<runeape_glyph> &rimgs ) override
+            {
+                size_type width = 0;
 
-                return rimg;
+                for ( const auto &ri : rimgs )
+                {
+                    width += ri.width;
+                }
+
+                return width;
             }
         };
 
@@ -225,13 +293,17 @@ namespace srilakshmikanthanp
 
            public:
             using runeape_config = Runeapeconfig;
+            using allocator_type = typename runeape_config::allocator_type;
 
            private:
-            using char_type     = typename runeape_config::char_type;
-            using size_type     = typename runeape_config::size_type;
-            using string_type   = typename runeape_config::string_type;
-            using shrink_type   = typename runeape_config::shrink;
-            using runeape_image = typename runeape_config::runeape_image;
+            using char_type      = typename runeape_config::char_type;
+            using size_type      = typename runeape_config::size_type;
+            using traits_type    = typename runeape_config::traits_type;
+            using string_type    = typename runeape_config::string_type;
+            using shrink_type    = typename runeape_config::shrink;
+            using runeape_image  = typename runeape_config::runeape_image;
+            using runeape_canvas = typename runeape_config::runeape_canvas;
+            using runeape_glyph  = typename runeape_config::runeape_glyph;
             template <typename T>
             using vector_type = typename runeape_config::template vector_type<T>;
 
@@ -242,9 +314,10 @@ namespace srilakshmikanthanp
             static constexpr shrink_type shrink_level = shrink_type::level_1;
 
            private:
-            runeape_config     config;
-            const unsigned int kerning_space = Kerning;
-            char_type          null { '\0' };
+            runeape_config         config;
+            const unsigned int     kerning_space = Kerning;
+            vector_type<size_type> marks;
+            vector_type<size_type> trail;
 
             /**
              * @brief converts ascii text of std::string to
@@ -256,132 +329,81 @@ namespace srilakshmikanthanp
             }
 
             /**
-             * @brief checks Height equal or not
-             * @param img runeape_image
+             * @brief  finds minspace between image and glyph from
+             *         trailing spaces of image and left edges
+             *         of glyph
+             * @param  trail trailing spaces of rows of image
+             * @param  img runeape_glyph
+             * @return minspace
              **/
-            void error_check( const runeape_image &img ) const
+            size_type minspace( const vector_type<size_type> &trail, const runeape_glyph &img ) const
             {
-                if ( img.size() != this->config.Height )
-                {
-                    throw std::runtime_error( "Height should be equal" );
-                }
-            }
+                size_type ms = string_type::npos;
 
-            /**
-             * @brief removes HardBlank
-             * @param rimg runeape_image
-             **/
-            void remove_hardblank( runeape_image &rimg )
-            {
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    std::replace( rimg[i].begin(), rimg[i].end(), this->config.HardBlank, ' ' );
+                    ms = std::min( ms, trail[i] + img.left[i] );
                 }
-            }
-
-            /**
-             * @brief add null to last non white space char of 
-             *        runeape_image
-             * @param img runeape_image
-             **/
-            void append_null( runeape_image &img )
-            {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    size_type p = img[i].find_last_not_of( ' ' );
 
-                    if ( p == string_type::npos )
-                    {
-                        img[i] = string_type( 1, null ) + img[i];
-                    }
-                    else
-                    {
-                        img[i].insert( p + 1, 1, null );
-                    }
-                }
+                return ms;
             }
 
             /**
-             * @brief appends runeape_image
-             * @param img1 runeape_image
-             * @param img2 runeape_image
+             * @brief  does kening in canvas and runeape_glyph, right
+             *         edges of canvas are kept in trail so shift of
+             *         glyph is known from minspace, glyph is written
+             *         once at its final column with HardBlank removed,
+             *         columns past end of rows are still blank
+             * @param  img1 runeape_canvas
+             * @param  len length of rows of img1
+             * @param  trail trailing spaces of rows of img1
+             * @param  img2 runeape_glyph
+             * @return new length of rows
              **/
-            void append_img( runeape_image &img1, const runeape_image &img2 )
+            size_type kerning( runeape_canvas &img1, size_type len, vector_type<size_type> &trail, const runeape_glyph &img2 )
             {
-                for ( size_type i = 0; i < config.Height; i++ )
-                {
-                    img1[i] += img2[i];
-                }
-            }
+                size_type ms = this->minspace( trail, img2 );
+                size_type ks = this->kerning_space;
 
-            /**
-             * @brief finds minspace between null
-             *        and non whitespace
-             * @param img runeape_image
-             **/
-            size_type minspace( runeape_image &img )
-            {
-                vector_type<size_type> nos( this->config.Height, 0 );
+                // glyph column j lands at column len + ks - ms + j,
+                // columns of glyph before end of ink of row and before
+                // column 0 are blank on both sides so they are skipped
+                size_type lead = len + ks;
 
                 for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type p = img[i].find_first_of( null );
+                    size_type        at   = std::max( len - trail[i] + ms, lead ) - ms;
+                    size_type        skip = at + ms - lead;
+                    const char_type *src  = img2[i].data();
 
-                    while ( ( ++p < img[i].size() ) && ( img[i][p] == ' ' ) )
-                    {
-                        ++nos[i];
-                    }
+                    artlib_replace_copy( src + skip, src + img2.width, img1.row_data( i ) + at,
+                                       this->config.HardBlank, char_type( ' ' ) );
                 }
 
-                return *std::min_element( nos.begin(), nos.end() );
+                return this->advance( len, trail, img2, ms );
             }
 
             /**
-             * @brief deos the kerning process
-             * @param img runeape_image 
-             * @param minspace minspace
+             * @brief  moves trailing spaces of rows past glyph placed
+             *         minspace left of end of rows
+             * @param  len length of rows
+             * @param  trail trailing spaces of rows
+             * @param  img runeape_glyph
+             * @param  ms minspace of img
+             * @return new length of rows
              **/
-            void kerning_process( runeape_image &img, size_type minspace )
+            size_type advance( size_type len, vector_type<size_type> &trail, const runeape_glyph &img, size_type ms ) const
             {
-                if ( minspace == this->kerning_space )
-                {
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = img[i].find_first_of( null );
-                        img[i].erase( p, 1 );
-                    }
-                }
-                else if ( minspace > kerning_space )
-                {
-                    size_type witdh = minspace - kerning_space;
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = img[i].find_first_of( null );
-                        img[i].erase( p, ( witdh + 1 ) );
-                    }
-                }
-                else
+                size_type ks = this->kerning_space;
+
+                for ( size_type i = 0; i < this->config.Height; i++ )
                 {
-                    size_type witdh = kerning_space - minspace;
-                    for ( size_type i = 0; i < this->config.Height; i++ )
-                    {
-                        size_type p = img[i].find_first_of( null );
-                        img[i].erase( p, 1 );
-                        img[i].insert( p, witdh, ' ' );
-                    }
+                    trail[i] = img.left[i] == img.width
+                                   ? trail[i] + img.width + ks - ms
+                                   : img.right[i];
                 }
-            }
 
-            /**
-             * @brief does kening in runeape_image and runeape_image
-             * @param img1 runeape_image
-             * @param img2 runeape_image
-             **/
-            void kerning( runeape_image &img1, const runeape_image &img2 )
-            {
-                append_null( img1 );
-                append_img( img1, img2 );
-                kerning_process( img1, minspace( img1 ) );
+                return len + img.width + ks - ms;
             }
 
            public:
@@ -393,12 +415,25 @@ namespace srilakshmikanthanp
             basic_runeape_kerning_style &operator=( const basic_runeape_kerning_style & ) = default;
             basic_runeape_kerning_style &operator=( basic_runeape_kerning_style && ) noexcept = default;
 
+            /**
+             * @brief constructor, scratch of style is allocated by
+             *        alloc
+             * @param alloc allocator
+             **/
+            explicit basic_runeape_kerning_style( const allocator_type &alloc )
+                : marks( alloc ),
+                  trail( alloc )
+            {
+            }
+
             /**
              * @brief clears the content
              **/
             void clear() override
             {
                 this->config.clear();
+                this->marks.clear();
+                this->trail.clear();
             }
 
             /**
@@ -409,6 +444,8 @@ namespace srilakshmikanthanp
             {
                 using std::swap;
                 swap( this->config, obj.config );
+                swap( this->marks, obj.marks );
+                swap( this->trail, obj.trail );
             }
 
             /**
@@ -422,26 +459,69 @@ namespace srilakshmikanthanp
 
             /**
              * @brief  used to get runeape_image asper the style
-             * @param  rimgs vector of runeape_image
+             * @param  rimgs vector of runeape_glyph
              * @return runeape_image
              **/
-            runeape_image operator()( const vector_type<runeape_image> &rimgs ) override
+            runeape_image operator()( const vector_type<runeape_glyph> &rimgs ) override
+            {
+                runeape_canvas canvas( allocator_type( this->marks.get_allocator() ) );
+                runeape_image  ret( canvas.get_allocator() );
+
+                ( *this )( rimgs, canvas );
+
+                canvas.to( ret );
+
+                return ret;
+            }
+
+            /**
+             * @brief  used to render runeape_glyphs in kerning style
+             *         in to canvas, stride is bound of width so rows
+             *         grow in place
+             * @param  rimgs vector of runeape_glyph
+             * @param  canvas runeape_canvas to render in
+             **/
+            void operator()( const vector_type<runeape_glyph> &rimgs, runeape_canvas &canvas ) override
             {
-                runeape_image rimg( this->config.Height, string_type() );
+                vector_type<size_type> &trail = this->trail;
+                size_type               bound = 0;
+                size_type               len   = 0;
+
+                trail.assign( this->config.Height, 0 );
 
                 for ( const auto &ri : rimgs )
                 {
-                    this->error_check( ri );
+                    bound += ri.width + this->kerning_space;
                 }
 
+                canvas.assign( 0, this->config.Height, bound );
+
                 for ( const auto &ri : rimgs )
                 {
-                    kerning( rimg, ri );
+                    len = kerning( canvas, len, trail, ri );
                 }
 
-                remove_hardblank( rimg );
+                canvas.set_width( len );
+            }
+
+            /**
+             * @brief  width of runeape_glyphs in kerning style, found
+             *         from widths and edges of glyphs alone
+             * @param  rimgs vector of runeape_glyph
+             * @return width
+             **/
+            size_type measure( const vector_type<runeape_glyph> &rimgs ) override
+            {
+                size_type len = 0;
+
+                this->marks.assign( this->config.Height, 0 );
+
+                for ( const auto &ri : rimgs )
+                {
+                    len = this->advance( len, this->marks, ri, this->minspace( this->marks, ri ) );
+                }
 
-                return rimg;
+                return len;
             }
         };
 
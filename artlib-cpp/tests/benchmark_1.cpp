@@ -0,0 +1,127 @@
+#include "algorithm"
+#include "artlib.hpp"
+#include "chrono"
+#include "iostream"
+#include "string"
+#include "vector"
+
+#define FONTDIR "path to font dir"
+
+using namespace srilakshmikanthanp::art;
+
+using anixt_glyph = anixt_config<char>::anixt_glyph;
+
+/**
+ * @brief  renders glyphs count times in to canvas
+ * @param  style style to render with
+ * @param  glyphs glyphs to render
+ * @param  count number of renders
+ * @return microseconds per render
+ **/
+template <typename StyleT>
+double render( StyleT &style, const std::vector<anixt_glyph> &glyphs, int count )
+{
+    anixt_canvas canvas;
+    auto         start = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < count; i++ )
+    {
+        style( glyphs, canvas );
+    }
+
+    std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+
+    return took.count() / count;
+}
+
+/**
+ * @brief  checks rendering with and without pair table gives
+ *         same rows
+ * @param  style style to render with
+ * @param  glyphs glyphs with code
+ * @param  uncoded glyphs without code
+ * @return true if rows are same
+ **/
+template <typename StyleT>
+bool same( StyleT &style, const std::vector<anixt_glyph> &glyphs, const std::vector<anixt_glyph> &uncoded )
+{
+    anixt_canvas with, without;
+
+    // rendered twice so second render reads pairs filled by first
+    style( glyphs, with );
+    style( glyphs, with );
+    style( uncoded, without );
+
+    return std::vector<std::string>( with.begin(), with.end() ) == std::vector<std::string>( without.begin(), without.end() );
+}
+
+/**
+ * @brief  compares rendering with and without pair table, glyphs
+ *         without code are not looked up in pair table
+ * @param  name name of style
+ * @param  font font of glyphs
+ * @param  text text to render
+ * @return true if both give same output
+ **/
+template <typename StyleT>
+bool compare( const char *name, const anixt_json_font &font, const std::string &text )
+{
+    std::vector<anixt_glyph> glyphs, uncoded;
+    StyleT                   style;
+
+    style.set_config( font.get_anixt_config() );
+
+    for ( char ch : text )
+    {
+        glyphs.push_back( font.get_anixt_glyph( static_cast<unsigned char>( ch ) ) );
+        uncoded.push_back( glyphs.back() );
+        uncoded.back().code = anixt_glyph::no_code;
+    }
+
+    if ( !same( style, glyphs, uncoded ) )
+    {
+        std::cout << "  " << name << " : output with pairs is not same\n";
+        return false;
+    }
+
+    double without = 0, with = 0;
+
+    // best of runs, time of one run is noisy
+    for ( int i = 0; i < 20; i++ )
+    {
+        without = i == 0 ? render( style, uncoded, 200 ) : std::min( without, render( style, uncoded, 200 ) );
+        with    = i == 0 ? render( style, glyphs, 200 ) : std::min( with, render( style, glyphs, 200 ) );
+    }
+
+    std::cout << "  " << name << " : " << without << "us without pairs, "
+              << with << "us with pairs, " << without / with << "x\n";
+
+    return true;
+}
+
+int main()
+{
+    std::string text;
+
+    while ( text.size() < 200 )
+    {
+        text += "The quick brown fox jumps over the lazy dog. ";
+    }
+
+    text.resize( 200 );
+
+    bool passed = true;
+
+    for ( const char *name : { "straight.json", "slant.json", "bubble.json" } )
+    {
+        anixt_json_font font;
+
+        font.set_font( std::string( FONTDIR ) + name );
+
+        std::cout << name << "\n";
+
+        passed = compare<anixt_smushed_style>( "smushed", font, text ) && passed;
+    }
+
+    return passed ? 0 : 1;
+}
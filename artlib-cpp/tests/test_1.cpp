@@ -0,0 +1,92 @@
+#include "artlib.hpp"
+#include "filesystem"
+#include "fstream"
+#include "iostream"
+#include "string"
+#include "vector"
+
+using namespace srilakshmikanthanp::art;
+
+/**
+ * @brief letters of FIGlet standard.flf used by test, other
+ *        letters are blank
+ **/
+const std::vector<std::pair<char, std::vector<std::string>>> letters = {
+    { 'F', { "  _____ ", " |  ___|", " | |_   ", " |  _|  ", " |_|    ", "        " } },
+    { '.', { "    ", "    ", "    ", "  _ ", " (_)", "    " } },
+    { ',', { "    ", "    ", "    ", "  _ ", " ( )", " |/ " } },
+    { '/', { "     __", "    / /", "   / / ", "  / /  ", " /_/   ", "       " } },
+    { 'i', { "  _ ", " (_)", " | |", " | |", " |_|", "    " } },
+    { 'l', { "  _ ", " | |", " | |", " | |", " |_|", "    " } },
+};
+
+/**
+ * @brief text and output of figlet for it with standard.flf
+ **/
+const std::vector<std::pair<std::string, std::vector<std::string>>> expected = {
+    { "F.", { " _____ ", "|  ___|", "| |_   ", "|  _|_ ", "|_| (_)", "       " } },
+    { "/,", { "    __", "   / /", "  / / ", " / /_ ", "/_/( )", "   |/ " } },
+    { "il", { " _ _ ", "(_) |", "| | |", "| | |", "|_|_|", "     " } },
+    { "Fi.", { " _____ _   ", "|  ___(_)  ", "| |_  | |  ", "|  _| | |_ ", "|_|   |_(_)", "           " } },
+    { "F,l.", { " _____ _   ", "|  ___| |  ", "| |_  | |  ", "|  _|_| |_ ", "|_| ( )_(_)", "    |/     " } },
+    { "i/l", { " _    ___ ", "(_)  / / |", "| | / /| |", "| |/ / | |", "|_/_/  |_|", "          " } },
+};
+
+/**
+ * @brief  writes FIGlet font of letters with layout of
+ *         standard.flf, endmarks of odd letters are followed
+ *         by white space that FIGlet drops
+ * @param  fp path of font
+ **/
+void write_font( const std::filesystem::path &fp )
+{
+    std::ofstream file( fp );
+
+    file << "flf2a$ 6 5 16 15 1 0 24463\n";
+    file << "part of standard.flf\n";
+
+    for ( int code = 32; code < 127; code++ )
+    {
+        std::vector<std::string> rows( 6, " $" );
+
+        for ( const auto &letter : letters )
+        {
+            if ( letter.first == code )
+            {
+                rows = letter.second;
+            }
+        }
+
+        for ( std::size_t i = 0; i < rows.size(); i++ )
+        {
+            file << rows[i] << ( i + 1 == rows.size() ? "@@" : "@" ) << ( code % 2 ? " \t\n" : "\n" );
+        }
+    }
+}
+
+int main()
+{
+    std::filesystem::path fp = std::filesystem::temp_directory_path() / "artlib_test_1.flf";
+
+    write_font( fp );
+
+    anixt_renderer<anixt_smushed_style, anixt_flf_font> renderer( fp );
+    int                                                 failed = 0;
+
+    for ( const auto &test : expected )
+    {
+        auto rows = renderer.render( test.first );
+
+        if ( std::vector<std::string>( rows.begin(), rows.end() ) != test.second )
+        {
+            std::cout << "failed: " << test.first << rows << std::endl;
+            failed++;
+        }
+    }
+
+    std::filesystem::remove( fp );
+
+    std::cout << ( expected.size() - failed ) << " of " << expected.size() << " passed" << std::endl;
+
+    return failed == 0 ? 0 : 1;
+}